@@ -0,0 +1,81 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef BENCH_BASE_HPP_DSTRUCT
+#define BENCH_BASE_HPP_DSTRUCT
+
+#include <cstdio>
+#include <chrono>
+
+#include <dstruct.hpp>
+
+#define BENCH_LOG(...) \
+{ \
+    printf("\033[33mDStruct BENCH: \t"); \
+    printf(__VA_ARGS__); \
+    printf("\033[0m\n"); \
+}
+
+namespace bench {
+
+static long long now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+// keep the compiler from optimizing away a benchmark result
+template <typename T>
+static void do_not_optimize(const T &val) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(val) : "memory");
+#else
+    static volatile const T *sink;
+    sink = &val;
+#endif
+}
+
+struct Timer {
+    Timer() : mStart_d { now_ns() } { }
+
+    void reset() { mStart_d = now_ns(); }
+
+    long long elapsed_ns() const { return now_ns() - mStart_d; }
+
+    double elapsed_ms() const { return elapsed_ns() / 1000000.0; }
+
+private:
+    long long mStart_d;
+};
+
+// latency statistics of a op: max / avg
+struct Latency {
+    Latency() : mMax_d { 0 }, mTotal_d { 0 }, mCnt_d { 0 } { }
+
+    template <typename Callback>
+    void record(Callback cb) {
+        long long start = now_ns();
+        cb();
+        long long ns = now_ns() - start;
+        if (ns > mMax_d) mMax_d = ns;
+        mTotal_d += ns;
+        mCnt_d++;
+    }
+
+    long long max_ns() const { return mMax_d; }
+
+    double avg_ns() const { return mCnt_d ? static_cast<double>(mTotal_d) / mCnt_d : 0; }
+
+private:
+    long long mMax_d, mTotal_d, mCnt_d;
+};
+
+}
+
+#endif
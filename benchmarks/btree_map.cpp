@@ -0,0 +1,100 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <map>
+
+#include "BenchBase.hpp"
+
+constexpr int KEY_NUM = 2000000;
+
+using Key = unsigned long long;
+
+static unsigned long long next_rand(unsigned long long &seed) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return seed >> 1;
+}
+
+// ordered index: random insert, random hit lookup, in-order scan, erase half
+template <typename MapType, typename FindFunc, typename ScanFunc, typename EraseFunc>
+static void bench_map(const char *name, const dstruct::Vector<Key> &keys,
+    FindFunc found, ScanFunc scan, EraseFunc erase) {
+    MapType map;
+
+    bench::Timer insertTimer;
+    for (int i = 0; i < KEY_NUM; i++) {
+        map[keys[i]] = i;
+    }
+    double insertMs = insertTimer.elapsed_ms();
+
+    bench::Timer findTimer;
+    long long hit = 0;
+    for (int i = KEY_NUM - 1; i >= 0; i--) {
+        hit += found(map, keys[i]);
+    }
+    double findMs = findTimer.elapsed_ms();
+
+    bench::Timer scanTimer;
+    long long sum = 0;
+    for (int round = 0; round < 4; round++) {
+        sum += scan(map);
+    }
+    double scanMs = scanTimer.elapsed_ms();
+
+    bench::Timer eraseTimer;
+    for (int i = 0; i < KEY_NUM; i += 2) {
+        erase(map, keys[i]);
+    }
+    double eraseMs = eraseTimer.elapsed_ms();
+
+    DSTRUCT_ASSERT(hit == KEY_NUM);
+    bench::do_not_optimize(sum);
+    BENCH_LOG("%-26s insert %8.2f | find %8.2f | scan x 4 %8.2f | erase %8.2f ms",
+        name, insertMs, findMs, scanMs, eraseMs);
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+    printf("unsigned long long -> int, %d random keys\n\n", KEY_NUM);
+
+    dstruct::Vector<Key> keys;
+    keys.reserve(KEY_NUM);
+    unsigned long long seed = 2023;
+    for (int i = 0; i < KEY_NUM; i++) keys.push_back(next_rand(seed));
+
+    using StdMap = std::map<Key, int>;
+    bench_map<StdMap>("std::map", keys,
+        [](StdMap &map, Key key) { return map.find(key) != map.end(); },
+        [](StdMap &map) { long long sum = 0; for (auto &kv : map) sum += kv.second; return sum; },
+        [](StdMap &map, Key key) { map.erase(key); }
+    );
+
+    using AVLMap = dstruct::Map<Key, int>;
+    bench_map<AVLMap>("dstruct::Map(AVLTree)", keys,
+        [](AVLMap &map, Key key) { return map.find(key) != map.end(); },
+        [](AVLMap &map) { long long sum = 0; for (auto &kv : map) sum += kv.value; return sum; },
+        [](AVLMap &map, Key key) { map.pop(key); }
+    );
+
+    using BTreeMap = dstruct::BTreeMap<Key, int>;
+    bench_map<BTreeMap>("dstruct::BTreeMap(256B)", keys,
+        [](BTreeMap &map, Key key) { return map.find(key) != map.end(); },
+        [](BTreeMap &map) { long long sum = 0; for (auto &kv : map) sum += kv.value; return sum; },
+        [](BTreeMap &map, Key key) { map.pop(key); }
+    );
+
+    using BTreeMap512 = dstruct::BTreeMap<Key, int, dstruct::less<Key>, dstruct::Alloc, 512>;
+    bench_map<BTreeMap512>("dstruct::BTreeMap(512B)", keys,
+        [](BTreeMap512 &map, Key key) { return map.find(key) != map.end(); },
+        [](BTreeMap512 &map) { long long sum = 0; for (auto &kv : map) sum += kv.value; return sum; },
+        [](BTreeMap512 &map, Key key) { map.pop(key); }
+    );
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include "BenchBase.hpp"
+
+#define MEM_16M_BYTE 16 * 1024 * 1024
+
+using SMA = dstruct::StaticMemAllocator<MEM_16M_BYTE>;
+
+// baseline: a global mutex around the shared SMA
+struct MutexSMA {
+    static void * allocate(int bytes) {
+        std::lock_guard<std::mutex> guard(Mutex_());
+        return SMA::allocate(bytes);
+    }
+
+    static bool deallocate(void *addr, int bytes) {
+        std::lock_guard<std::mutex> guard(Mutex_());
+        return SMA::deallocate(addr, bytes);
+    }
+
+    static std::mutex & Mutex_() {
+        static std::mutex mutex;
+        return mutex;
+    }
+};
+
+struct LibcAlloc {
+    static void * allocate(int bytes) { return malloc(bytes); }
+    static bool deallocate(void *addr, int) { free(addr); return true; }
+};
+
+// every thread keep a window of live mem-block, replace one per op
+template <typename Alloc>
+static void worker(int threadId, int opNum) {
+    const int slotNum = 32;
+    void *memArr[slotNum] { nullptr };
+    int sizeArr[slotNum] { 0 };
+    unsigned int seed = threadId + 1;
+
+    for (int i = 0; i < opNum; i++) {
+        seed = seed * 1103515245 + 12345;
+        int slot = i % slotNum;
+        if (memArr[slot] != nullptr) Alloc::deallocate(memArr[slot], sizeArr[slot]);
+        sizeArr[slot] = 8 + (seed >> 16) % 121;
+        memArr[slot] = Alloc::allocate(sizeArr[slot]);
+        DSTRUCT_ASSERT(memArr[slot] != nullptr);
+    }
+
+    for (int i = 0; i < slotNum; i++) {
+        if (memArr[i] != nullptr) Alloc::deallocate(memArr[i], sizeArr[i]);
+    }
+}
+
+template <typename Alloc>
+static void bench_throughput(const char *name, int threadNum) {
+    const int opNum = 1000000;
+    dstruct::Vector<std::thread *> threads;
+
+    bench::Timer timer;
+    for (int i = 0; i < threadNum; i++) {
+        threads.push_back(new std::thread(worker<Alloc>, i, opNum));
+    }
+    for (auto t : threads) {
+        t->join();
+        delete t;
+    }
+    double ms = timer.elapsed_ms();
+
+    BENCH_LOG("%-24s threads %2d: %8.2f ms, %7.2f Mops/s",
+        name, threadNum, ms, opNum * threadNum / ms / 1000);
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    int threadNums[] { 1, 2, 4, 8 };
+
+    for (int threadNum : threadNums) {
+        bench_throughput<MutexSMA>("mutex + SMA", threadNum);
+        bench_throughput<dstruct::ConcurrentMemAllocator<SMA>>("ConcurrentMemAllocator", threadNum);
+        bench_throughput<LibcAlloc>("libc malloc", threadNum);
+    }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include "BenchBase.hpp"
+
+constexpr int OP_NUM = 10000000;
+
+struct CountAlloc {
+    static int allocateCnt;
+
+    static void * allocate(int bytes) {
+        allocateCnt++;
+        return dstruct::Alloc::allocate(bytes);
+    }
+
+    static void deallocate(void *addr, int bytes) {
+        dstruct::Alloc::deallocate(addr, bytes);
+    }
+};
+
+int CountAlloc::allocateCnt = 0;
+
+// producer/consumer: keep about `depth` elements in queue
+static void bench_steady(int depth) {
+    dstruct::Queue<int, CountAlloc> queue;
+    for (int i = 0; i < depth; i++) queue.push(i);
+    for (int i = 0; i < 100000; i++) { queue.push(i); queue.pop(); } // warm up: map table is stable
+
+    CountAlloc::allocateCnt = 0;
+    long long sum = 0;
+    bench::Timer timer;
+    for (int i = 0; i < OP_NUM; i++) {
+        queue.push(i);
+        sum += queue.front();
+        queue.pop();
+    }
+    bench::do_not_optimize(sum);
+    BENCH_LOG("steady depth %6d: %d push+pop, allocate %7d times, %8.2f ms",
+        depth, OP_NUM, CountAlloc::allocateCnt, timer.elapsed_ms());
+}
+
+// producer/consumer: fill a batch, then drain it
+static void bench_burst(int batch) {
+    dstruct::Queue<int, CountAlloc> queue;
+
+    CountAlloc::allocateCnt = 0;
+    long long sum = 0;
+    bench::Timer timer;
+    for (int r = 0; r < OP_NUM / batch; r++) {
+        for (int i = 0; i < batch; i++) queue.push(i);
+        while (!queue.empty()) {
+            sum += queue.front();
+            queue.pop();
+        }
+    }
+    bench::do_not_optimize(sum);
+    BENCH_LOG("burst  batch %6d: %d push+pop, allocate %7d times, %8.2f ms",
+        batch, OP_NUM, CountAlloc::allocateCnt, timer.elapsed_ms());
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    bench_steady(10);
+    bench_steady(1000);
+    bench_steady(100000);
+    bench_burst(100);
+    bench_burst(10000);
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include "BenchBase.hpp"
+
+constexpr int ELEM_NUM = 1000000;
+constexpr int ACCESS_NUM = 1000000;
+
+// xorshift, reproducible random index
+static unsigned int next_rand(unsigned int &x) {
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    return x;
+}
+
+template <typename DS>
+static void bench_random_access(const char *name, const DS &ds) {
+    unsigned int seed = 2023;
+    long long sum = 0;
+    bench::Timer timer;
+    for (int i = 0; i < ACCESS_NUM; i++) {
+        sum += ds[next_rand(seed) % ELEM_NUM];
+    }
+    bench::do_not_optimize(sum);
+    BENCH_LOG("%-18s %d random ds[i] over %d elements: %8.2f ms (%.1f ns/op)",
+        name, ACCESS_NUM, ELEM_NUM, timer.elapsed_ms(), timer.elapsed_ns() / static_cast<double>(ACCESS_NUM));
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    dstruct::Vector<int> vec;
+    dstruct::Deque<int> deque;
+    for (int i = 0; i < ELEM_NUM; i++) {
+        vec.push_back(i);
+        if (i % 2) deque.push_back(i);
+        else deque.push_front(i);
+    }
+
+    bench_random_access("Vector<int>", vec);
+    bench_random_access("Deque<int, 32>", deque);
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include "BenchBase.hpp"
+
+constexpr int VERTEX_NUM = 200000;
+constexpr int DEGREE = 10;
+constexpr long long INF = 1LL << 60;
+
+struct Edge {
+    int to, weight;
+};
+
+struct Item {
+    long long dist;
+    int vertex;
+
+    bool operator<(const Item &item) const { return dist < item.dist; }
+};
+
+using Graph = dstruct::Vector<dstruct::Vector<Edge>>;
+
+// lazy deletion: push duplicates, skip stale entries when popped
+static long long dijkstra_lazy(const Graph &graph, int &peakSize) {
+    dstruct::PriorityQueue<Item> queue;
+    dstruct::Vector<long long> dist(VERTEX_NUM, INF);
+
+    dist[0] = 0;
+    queue.push(Item { 0, 0 });
+    while (!queue.empty()) {
+        Item item = queue.top(); queue.pop();
+        if (item.dist > dist[item.vertex]) continue; // stale
+        for (auto &e : graph[item.vertex]) {
+            long long d = item.dist + e.weight;
+            if (d < dist[e.to]) {
+                dist[e.to] = d;
+                queue.push(Item { d, e.to });
+            }
+        }
+        if (static_cast<int>(queue.size()) > peakSize) peakSize = queue.size();
+    }
+
+    return dist[VERTEX_NUM - 1];
+}
+
+// decrease-key: one entry per vertex
+static long long dijkstra_indexed(const Graph &graph, int &peakSize) {
+    dstruct::IndexedPriorityQueue<long long> queue;
+    dstruct::Vector<long long> dist(VERTEX_NUM, INF);
+    dstruct::Vector<int> handles(VERTEX_NUM, -1), vertexOf(VERTEX_NUM, -1);
+
+    dist[0] = 0;
+    handles[0] = queue.push(0);
+    vertexOf[handles[0]] = 0;
+    while (!queue.empty()) {
+        int u = vertexOf[queue.top_handle()];
+        queue.pop();
+        for (auto &e : graph[u]) {
+            long long d = dist[u] + e.weight;
+            if (d >= dist[e.to]) continue;
+            dist[e.to] = d;
+            int handle = handles[e.to];
+            if (queue.contains(handle) && vertexOf[handle] == e.to) {
+                queue.update(handle, d);
+            } else {
+                handles[e.to] = queue.push(d);
+                vertexOf[handles[e.to]] = e.to;
+            }
+        }
+        if (static_cast<int>(queue.size()) > peakSize) peakSize = queue.size();
+    }
+
+    return dist[VERTEX_NUM - 1];
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+    printf("vertex: %d, edge: %d\n", VERTEX_NUM, VERTEX_NUM * DEGREE);
+
+    Graph graph;
+    graph.reserve(VERTEX_NUM);
+    for (int i = 0; i < VERTEX_NUM; i++) graph.push_back(dstruct::Vector<Edge>());
+
+    unsigned long long seed = 2023;
+    for (int i = 0; i < VERTEX_NUM; i++) {
+        for (int j = 0; j < DEGREE; j++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            int to = (seed >> 33) % VERTEX_NUM;
+            graph[i].push_back(Edge { to, static_cast<int>((seed >> 13) % 1000) + 1 });
+        }
+        graph[i].push_back(Edge { (i + 1) % VERTEX_NUM, 1000 }); // connected
+    }
+
+    int lazyPeak = 0, indexedPeak = 0;
+
+    bench::Timer lazyTimer;
+    long long lazyDist = dijkstra_lazy(graph, lazyPeak);
+    double lazyMs = lazyTimer.elapsed_ms();
+
+    bench::Timer indexedTimer;
+    long long indexedDist = dijkstra_indexed(graph, indexedPeak);
+    double indexedMs = indexedTimer.elapsed_ms();
+
+    DSTRUCT_ASSERT(lazyDist == indexedDist);
+    bench::do_not_optimize(indexedDist);
+
+    BENCH_LOG("PriorityQueue + lazy deletion:   %8.2f ms, peak heap size %d", lazyMs, lazyPeak);
+    BENCH_LOG("IndexedPriorityQueue + update:   %8.2f ms, peak heap size %d", indexedMs, indexedPeak);
+
+    return 0;
+}
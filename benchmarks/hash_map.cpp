@@ -0,0 +1,135 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <unordered_map>
+
+#include "BenchBase.hpp"
+
+constexpr int KEY_NUM = 1000000;
+
+using Key = unsigned long long;
+
+static unsigned long long next_rand(unsigned long long &seed) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return seed >> 1;
+}
+
+// keys: present, missKeys: absent
+template <typename MapType, typename FindFunc>
+static void bench_map(const char *name, const dstruct::Vector<Key> &keys,
+    const dstruct::Vector<Key> &missKeys, FindFunc found) {
+
+    MapType map;
+
+    bench::Timer insertTimer;
+    for (int i = 0; i < KEY_NUM; i++) {
+        map[keys[i]] = i;
+    }
+    double insertMs = insertTimer.elapsed_ms();
+
+    bench::Timer hitTimer;
+    long long hit = 0;
+    for (int i = 0; i < KEY_NUM; i++) {
+        hit += found(map, keys[i]);
+    }
+    double hitMs = hitTimer.elapsed_ms();
+
+    bench::Timer missTimer;
+    for (int i = 0; i < KEY_NUM; i++) {
+        hit += found(map, missKeys[i]);
+    }
+    double missMs = missTimer.elapsed_ms();
+
+    DSTRUCT_ASSERT(hit == KEY_NUM);
+    bench::do_not_optimize(hit);
+    BENCH_LOG("%-22s insert %8.2f ms | hit %8.2f ms | miss %8.2f ms", name, insertMs, hitMs, missMs);
+}
+
+// dedup filter: mostly negative lookups at a high load factor
+static void bench_high_load_miss(const dstruct::Vector<Key> &keys, const dstruct::Vector<Key> &missKeys) {
+    const int keyNum = 1 << 20; // 1M
+    dstruct::HashSet<Key> set;
+    set.max_load_factor(0.95f);
+    set.reserve(keyNum * 0.93);
+    for (int i = 0; i < keyNum * 0.93; i++) set.push(keys[i]);
+
+    bench::Timer timer;
+    long long hit = 0;
+    for (int round = 0; round < 4; round++) {
+        for (int i = 0; i < KEY_NUM; i++) hit += set.contains(missKeys[i]);
+    }
+    double ms = timer.elapsed_ms();
+
+    DSTRUCT_ASSERT(hit == 0);
+    BENCH_LOG("HashSet load %.2f      miss x 4 %8.2f ms", set.load_factor(), ms);
+}
+
+// counter aggregation: old operator[](find + push + find) vs one lookup find_or_insert
+template <typename MapType>
+static void bench_counter(const char *name, const dstruct::Vector<Key> &keys, int distinct) {
+    MapType oldMap, newMap;
+
+    bench::Timer oldTimer;
+    for (int i = 0; i < KEY_NUM; i++) {
+        Key key = keys[i % distinct];
+        auto it = oldMap.find(key);
+        if (it == oldMap.end()) {
+            oldMap.push({ key, 0 });
+            it = oldMap.find(key);
+        }
+        dstruct::_remove_const(it->value)++;
+    }
+    double oldMs = oldTimer.elapsed_ms();
+
+    bench::Timer newTimer;
+    for (int i = 0; i < KEY_NUM; i++) {
+        dstruct::_remove_const(newMap.find_or_insert(keys[i % distinct]).it->value)++;
+    }
+    double newMs = newTimer.elapsed_ms();
+
+    DSTRUCT_ASSERT(oldMap.size() == newMap.size() && newMap.find(keys[0])->value == KEY_NUM / distinct);
+    BENCH_LOG("%-22s %7d keys: find+push+find %8.2f ms | find_or_insert %8.2f ms", name, distinct, oldMs, newMs);
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+    printf("unsigned long long -> int, %d keys\n\n", KEY_NUM);
+
+    dstruct::Vector<Key> keys, missKeys;
+    keys.reserve(KEY_NUM);
+    missKeys.reserve(KEY_NUM);
+    unsigned long long seed = 2023;
+    for (int i = 0; i < KEY_NUM; i++) {
+        keys.push_back(next_rand(seed) | 1);       // odd
+        missKeys.push_back(next_rand(seed) & ~1ULL); // even
+    }
+
+    bench_map<std::unordered_map<Key, int>>("std::unordered_map", keys, missKeys,
+        [](std::unordered_map<Key, int> &map, Key key) { return map.find(key) != map.end(); });
+    bench_map<dstruct::Map<Key, int>>("dstruct::Map(AVLTree)", keys, missKeys,
+        [](dstruct::Map<Key, int> &map, Key key) { return map.find(key) != map.end(); });
+    bench_map<dstruct::HashMap<Key, int>>("dstruct::HashMap", keys, missKeys,
+        [](dstruct::HashMap<Key, int> &map, Key key) { return map.find(key) != map.end(); });
+
+#ifdef DSTRUCT_SIMD_SSE2
+    printf("\nprobe: SSE2 16-byte group(-DDSTRUCT_DISABLE_SIMD for scalar)\n");
+#else
+    printf("\nprobe: scalar\n");
+#endif
+    bench_high_load_miss(keys, missKeys);
+
+    printf("\ncounter: %d increments\n", KEY_NUM);
+    for (int distinct : { 100000, KEY_NUM / 2 }) {
+        bench_counter<dstruct::Map<Key, int>>("dstruct::Map(AVLTree)", keys, distinct);
+        bench_counter<dstruct::HashMap<Key, int>>("dstruct::HashMap", keys, distinct);
+    }
+
+    return 0;
+}
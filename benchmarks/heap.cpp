@@ -0,0 +1,114 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <queue>
+#include <algorithm>
+
+#include "BenchBase.hpp"
+
+constexpr int OBJ_NUM = 4000000;
+
+// 16 bytes, 4 children in a quarter cache line
+struct Event {
+    unsigned long long time;
+    unsigned long long id;
+
+    bool operator<(const Event &e) const { return time < e.time; }
+    bool operator>(const Event &e) const { return time > e.time; }
+};
+
+template <typename HeapType, typename T>
+static void bench_push_pop(const char *name, const dstruct::Vector<T> &objs) {
+    HeapType heap;
+
+    bench::Timer pushTimer;
+    for (auto it = objs.begin(); it != objs.end(); ++it) {
+        heap.push(*it);
+    }
+    double pushMs = pushTimer.elapsed_ms();
+
+    bench::Timer popTimer;
+    T sum {};
+    while (!heap.empty()) {
+        sum = heap.top();
+        heap.pop();
+    }
+    double popMs = popTimer.elapsed_ms();
+
+    bench::do_not_optimize(sum);
+    BENCH_LOG("%-28s push %8.2f ms | pop %8.2f ms", name, pushMs, popMs);
+}
+
+template <typename T>
+static void bench_all(const char *typeName, const dstruct::Vector<T> &objs) {
+    printf("\n%s x %d\n", typeName, OBJ_NUM);
+    bench_push_pop<std::priority_queue<T, std::vector<T>, std::greater<T>>>("std::priority_queue", objs);
+    bench_push_pop<dstruct::MinHeap<T>>("dstruct::MinHeap(binary)", objs);
+    bench_push_pop<dstruct::DAryHeap<T, 4>>("dstruct::DAryHeap<T, 4>", objs);
+    bench_push_pop<dstruct::DAryHeap<T, 8>>("dstruct::DAryHeap<T, 8>", objs);
+}
+
+// in-place heapsort vs copy to a heap and pop back
+template <typename T>
+static void bench_heap_sort(const char *typeName, const dstruct::Vector<T> &objs) {
+    printf("\nheapsort: %s x %d\n", typeName, OBJ_NUM);
+
+    dstruct::Vector<T> data(objs);
+    bench::Timer copyTimer;
+    {
+        dstruct::MinHeap<T> heap(data.begin(), data.end());
+        for (auto it = data.begin(); it != data.end(); it++) {
+            *it = heap.top(); heap.pop();
+        }
+    }
+    BENCH_LOG("%-36s %8.2f ms", "MinHeap copy + pop(old Heap::sort)", copyTimer.elapsed_ms());
+
+    data = objs;
+    bench::Timer stdTimer;
+    std::make_heap(&data[0], &data[0] + OBJ_NUM);
+    std::sort_heap(&data[0], &data[0] + OBJ_NUM);
+    BENCH_LOG("%-36s %8.2f ms", "std::make_heap + sort_heap", stdTimer.elapsed_ms());
+
+    data = objs;
+    bench::Timer dstructTimer;
+    dstruct::algorithm::make_heap(data.begin(), data.end());
+    dstruct::algorithm::sort_heap(data.begin(), data.end());
+    BENCH_LOG("%-36s %8.2f ms", "dstruct::algorithm make/sort_heap", dstructTimer.elapsed_ms());
+
+    data = objs;
+    bench::Timer partialTimer;
+    dstruct::algorithm::partial_sort(data.begin(), data.begin() + OBJ_NUM / 100, data.end());
+    BENCH_LOG("%-36s %8.2f ms", "dstruct::algorithm::partial_sort 1%", partialTimer.elapsed_ms());
+    bench::do_not_optimize(data[0]);
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    dstruct::Vector<int> ints;
+    dstruct::Vector<Event> events;
+    ints.reserve(OBJ_NUM);
+    events.reserve(OBJ_NUM);
+
+    unsigned long long seed = 2023;
+    for (int i = 0; i < OBJ_NUM; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        ints.push_back(static_cast<int>(seed >> 33));
+        events.push_back(Event { seed >> 20, static_cast<unsigned long long>(i) });
+    }
+
+    bench_all("int", ints);
+    bench_all("Event(16 bytes)", events);
+
+    bench_heap_sort("int", ints);
+    bench_heap_sort("Event(16 bytes)", events);
+
+    return 0;
+}
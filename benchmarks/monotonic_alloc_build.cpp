@@ -0,0 +1,68 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include "BenchBase.hpp"
+
+using MonotonicAlloc = dstruct::MonotonicAllocator<dstruct::Alloc>;
+
+constexpr int NODE_NUM = 200000;
+
+static int key_of(int i) {
+    return static_cast<int>((i * 7919LL) % NODE_NUM); // scatter, no dup
+}
+
+// build + traversal + destroy a temporary dstruct
+template <typename DStruct>
+static double bench_build(DStruct &ds) {
+    bench::Timer timer;
+    for (int i = 0; i < NODE_NUM; i++) {
+        ds.push(key_of(i));
+    }
+    long long sum = 0;
+    for (auto val : ds) sum += val;
+    bench::do_not_optimize(sum);
+    ds.clear();
+    return timer.elapsed_ms();
+}
+
+template <typename Alloc>
+using AVLTree_ = dstruct::AVLTree<int, dstruct::less<int>, Alloc>;
+
+template <template <typename> class DStruct>
+static void bench_dstruct(const char *name) {
+    double portMs, monoMs;
+    {
+        DStruct<dstruct::Alloc> ds;
+        portMs = bench_build(ds);
+    }
+    {
+        MonotonicAlloc mAlloc;
+        DStruct<MonotonicAlloc> ds(mAlloc);
+        monoMs = bench_build(ds);
+    }
+    BENCH_LOG("%-12s %d nodes: port(per-node alloc) %8.2f ms, MonotonicAllocator %8.2f ms",
+        name, NODE_NUM, portMs, monoMs);
+}
+
+template <typename Alloc>
+using SLinkedList_ = dstruct::SLinkedList<int, Alloc>;
+
+template <typename Alloc>
+using BSTree_ = dstruct::BSTree<int, Alloc>;
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    bench_dstruct<SLinkedList_>("SLinkedList");
+    bench_dstruct<BSTree_>("BSTree");
+    bench_dstruct<AVLTree_>("AVLTree");
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <mutex>
+#include <thread>
+
+#include "BenchBase.hpp"
+
+constexpr int OBJ_NUM = 2000000;
+constexpr int QUEUE_SIZE = 1024;
+
+// baseline: dstruct::Queue with a mutex
+template <typename T>
+struct MutexQueue {
+    MutexQueue(size_t) { }
+
+    bool try_push(const T &obj) {
+        std::lock_guard<std::mutex> guard(mMutex_d);
+        if (mQueue_d.size() == QUEUE_SIZE) return false;
+        mQueue_d.push(obj);
+        return true;
+    }
+
+    bool try_pop(T &obj) {
+        std::lock_guard<std::mutex> guard(mMutex_d);
+        if (mQueue_d.empty()) return false;
+        obj = mQueue_d.front();
+        mQueue_d.pop();
+        return true;
+    }
+
+    std::mutex mMutex_d;
+    dstruct::Queue<T> mQueue_d;
+};
+
+template <typename QueueType>
+static void producer(QueueType *queue, int objNum) {
+    for (int i = 0; i < objNum; i++) {
+        while (!queue->try_push(i)) std::this_thread::yield();
+    }
+}
+
+template <typename QueueType>
+static void consumer(QueueType *queue, int objNum, long long *sum) {
+    for (int i = 0; i < objNum; i++) {
+        int val;
+        while (!queue->try_pop(val)) std::this_thread::yield();
+        *sum += val;
+    }
+}
+
+template <typename QueueType>
+static double bench_throughput(int producerNum, int consumerNum) {
+    QueueType queue(QUEUE_SIZE);
+    dstruct::Vector<std::thread *> threads;
+    dstruct::Vector<long long> sums(consumerNum, 0);
+
+    bench::Timer timer;
+    for (int i = 0; i < producerNum; i++) {
+        threads.push_back(new std::thread(producer<QueueType>, &queue, OBJ_NUM / producerNum));
+    }
+    for (int i = 0; i < consumerNum; i++) {
+        threads.push_back(new std::thread(consumer<QueueType>, &queue, OBJ_NUM / consumerNum, &sums[i]));
+    }
+    for (auto t : threads) {
+        t->join();
+        delete t;
+    }
+    double opsPerUs = OBJ_NUM / (timer.elapsed_ns() / 1000.0);
+
+    bench::do_not_optimize(sums[0]);
+    return opsPerUs;
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+    printf("threads: %u, objs: %d, queue size: %d\n", std::thread::hardware_concurrency(), OBJ_NUM, QUEUE_SIZE);
+
+    const int threadNums[] = { 1, 2, 4, 8, 16 };
+    for (int producerNum : threadNums) {
+        for (int consumerNum : threadNums) {
+            if (producerNum != consumerNum && producerNum != 1 && consumerNum != 1) continue;
+            double mutexOps = bench_throughput<MutexQueue<int>>(producerNum, consumerNum);
+            double mpmcOps = bench_throughput<dstruct::MPMCQueue<int>>(producerNum, consumerNum);
+            BENCH_LOG("P%-2d C%-2d: mutex + dstruct::Queue %6.2f M ops/s | MPMCQueue %6.2f M ops/s",
+                producerNum, consumerNum, mutexOps, mpmcOps);
+        }
+    }
+
+    return 0;
+}
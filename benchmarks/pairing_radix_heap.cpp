@@ -0,0 +1,93 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include "BenchBase.hpp"
+
+constexpr int HEAP_SIZE = 1000000;
+constexpr int MELD_NUM = 100;
+constexpr int HOLD_OPS = 4000000;
+
+static unsigned long long next_rand(unsigned long long &seed) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return seed >> 33;
+}
+
+// merge MELD_NUM heaps of HEAP_SIZE / MELD_NUM into one
+template <typename HeapType, typename MergeFunc>
+static double bench_merge(MergeFunc merge) {
+    dstruct::Vector<HeapType *> heaps;
+    unsigned long long seed = 2023;
+    for (int i = 0; i < MELD_NUM; i++) {
+        heaps.push_back(new HeapType());
+        for (int j = 0; j < HEAP_SIZE / MELD_NUM; j++) {
+            heaps.back()->push(next_rand(seed));
+        }
+    }
+
+    bench::Timer timer;
+    for (int i = 1; i < MELD_NUM; i++) {
+        merge(*heaps[0], *heaps[i]);
+    }
+    bench::do_not_optimize(heaps[0]->top());
+    double ms = timer.elapsed_ms();
+
+    DSTRUCT_ASSERT(heaps[0]->size() == HEAP_SIZE);
+    for (auto heap : heaps) delete heap;
+
+    return ms;
+}
+
+// hold model of an event queue: pop the earliest, schedule a later one
+template <typename HeapType>
+static double bench_hold() {
+    HeapType heap;
+    unsigned long long seed = 2023;
+    for (int i = 0; i < HEAP_SIZE; i++) {
+        heap.push(next_rand(seed) % 1000000);
+    }
+
+    bench::Timer timer;
+    unsigned long long now = 0;
+    for (int i = 0; i < HOLD_OPS; i++) {
+        now = heap.top();
+        heap.pop();
+        heap.push(now + next_rand(seed) % 1000000);
+    }
+    bench::do_not_optimize(now);
+
+    return timer.elapsed_ms();
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    using Key = unsigned long long;
+
+    printf("\nmerge %d heaps, total %d objs\n", MELD_NUM, HEAP_SIZE);
+    double heapMs = bench_merge<dstruct::MinHeap<Key>>(
+        [](dstruct::MinHeap<Key> &h1, dstruct::MinHeap<Key> &h2) {
+            for (auto it = h2.begin(); it != h2.end(); ++it) h1.push(*it);
+            h2 = dstruct::MinHeap<Key>();
+        }
+    );
+    double pairingMs = bench_merge<dstruct::pmemory::PairingHeap<Key>>(
+        [](dstruct::pmemory::PairingHeap<Key> &h1, dstruct::pmemory::PairingHeap<Key> &h2) { h1.meld(h2); }
+    );
+    BENCH_LOG("MinHeap re-push:        %8.3f ms", heapMs);
+    BENCH_LOG("PairingHeap meld:       %8.3f ms", pairingMs);
+
+    printf("\nhold model: %d objs, %d pop + push with monotone keys\n", HEAP_SIZE, HOLD_OPS);
+    BENCH_LOG("MinHeap:                %8.2f ms", bench_hold<dstruct::MinHeap<Key>>());
+    BENCH_LOG("DAryHeap<4>:            %8.2f ms", bench_hold<dstruct::DAryHeap<Key, 4>>());
+    BENCH_LOG("pmemory::PairingHeap:   %8.2f ms", bench_hold<dstruct::pmemory::PairingHeap<Key>>());
+    BENCH_LOG("RadixHeap:              %8.2f ms", bench_hold<dstruct::RadixHeap<Key>>());
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include "BenchBase.hpp"
+
+constexpr int NODE_NUM = 100000;
+constexpr int ROUNDS = 10;
+
+static int key_of(int i) {
+    return static_cast<int>((i * 7919LL) % NODE_NUM); // scatter, no dup
+}
+
+// insert NODE_NUM node then erase all, ROUNDS times: return Mops/s
+template <typename List>
+static double bench_list() {
+    List list;
+    bench::Timer timer;
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < NODE_NUM; i++) list.push_back(i);
+        for (int i = 0; i < NODE_NUM; i++) list.pop_front();
+    }
+    return 2.0 * NODE_NUM * ROUNDS / timer.elapsed_ns() * 1000;
+}
+
+template <typename Tree>
+static double bench_tree() {
+    Tree tree;
+    bench::Timer timer;
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < NODE_NUM; i++) tree.push(key_of(i));
+        for (int i = 0; i < NODE_NUM; i++) tree.pop(key_of(i));
+    }
+    return 2.0 * NODE_NUM * ROUNDS / timer.elapsed_ns() * 1000;
+}
+
+template <typename Map>
+static double bench_map() {
+    Map map;
+    bench::Timer timer;
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < NODE_NUM; i++) map[key_of(i)] = i;
+        for (int i = 0; i < NODE_NUM; i++) map.pop(key_of(i));
+    }
+    return 2.0 * NODE_NUM * ROUNDS / timer.elapsed_ns() * 1000;
+}
+
+static void log_result(const char *name, double portMops, double poolMops) {
+    BENCH_LOG("%-12s insert/erase: port %7.2f Mops/s, PoolAlloc %7.2f Mops/s", name, portMops, poolMops);
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    using PortAVLTree = dstruct::AVLTree<int, dstruct::less<int>, dstruct::Alloc>;
+
+    log_result("SLinkedList",
+        bench_list<dstruct::SLinkedList<int>>(), bench_list<dstruct::pmemory::SLinkedList<int>>());
+    log_result("DLinkedList",
+        bench_list<dstruct::DLinkedList<int>>(), bench_list<dstruct::pmemory::DLinkedList<int>>());
+    log_result("AVLTree",
+        bench_tree<PortAVLTree>(), bench_tree<dstruct::pmemory::AVLTree<int>>());
+    log_result("Map",
+        bench_map<dstruct::Map<int, int>>(), bench_map<dstruct::pmemory::Map<int, int>>());
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <map>
+
+#include "BenchBase.hpp"
+
+constexpr int LEVEL_NUM = 100000;
+constexpr int OP_NUM = 2000000;
+
+static unsigned long long next_rand(unsigned long long &seed) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return seed >> 33;
+}
+
+// order book: price level -> quantity, every op adds a level and removes one(the best or a random one)
+template <typename MapType, typename EraseBestFunc>
+static double bench_order_book(EraseBestFunc erase_best) {
+    MapType book;
+    unsigned long long seed = 2023;
+    for (int i = 0; i < LEVEL_NUM; i++) {
+        book[static_cast<int>(next_rand(seed) % (LEVEL_NUM * 16))] += 1;
+    }
+
+    bench::Timer timer;
+    for (int i = 0; i < OP_NUM; i++) {
+        int price = static_cast<int>(next_rand(seed) % (LEVEL_NUM * 16));
+        book[price] += 1;
+        if (i % 2) erase_best(book);
+        else book.pop(static_cast<int>(next_rand(seed) % (LEVEL_NUM * 16)));
+    }
+    bench::do_not_optimize(book.size());
+
+    return timer.elapsed_ms();
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+    printf("order book: %d price levels, %d add + remove(best or random)\n\n", LEVEL_NUM, OP_NUM);
+
+    using StdMap = std::map<int, long long>;
+    struct StdBook : StdMap {
+        void pop(int key) { StdMap::erase(key); }
+    };
+    BENCH_LOG("std::map:                  %8.2f ms", bench_order_book<StdBook>(
+        [](StdBook &book) { book.erase(book.begin()); }));
+
+    using AVLMap = dstruct::Map<int, long long>;
+    // AVLTree::erase(it) copies the next obj, by key for KeyValue
+    BENCH_LOG("dstruct::Map(AVLTree):     %8.2f ms", bench_order_book<AVLMap>(
+        [](AVLMap &book) { book.pop(book.begin()->key); }));
+
+    using RBMap = dstruct::RBTreeMap<int, long long>;
+    BENCH_LOG("dstruct::RBTreeMap:        %8.2f ms", bench_order_book<RBMap>(
+        [](RBMap &book) { auto it = book.begin(); book.erase(it); }));
+
+    using PoolAVLMap = dstruct::pmemory::Map<int, long long>;
+    BENCH_LOG("pmemory::Map(AVLTree):     %8.2f ms", bench_order_book<PoolAVLMap>(
+        [](PoolAVLMap &book) { book.pop(book.begin()->key); }));
+
+    using PoolRBMap = dstruct::pmemory::RBTreeMap<int, long long>;
+    BENCH_LOG("pmemory::RBTreeMap:        %8.2f ms", bench_order_book<PoolRBMap>(
+        [](PoolRBMap &book) { auto it = book.begin(); book.erase(it); }));
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include "BenchBase.hpp"
+
+#define MEM_1M_BYTE 1024 * 1024
+
+// mem-pool of the previous SMA version: a address-sorted list + FFMA(First Fit)
+template <int MEMORY_SIZE>
+struct FirstFitMemPool {
+    using Link_e = dstruct::SinglyLink_;
+    using MemBlock_e = dstruct::EmbeddedListNode_<int, Link_e>;
+
+    static void * allocate(int bytes) {
+        bytes = MEM_ALIGN_ROUND_UP_(bytes);
+        auto &pool = Instance_();
+        Link_e *preLinkPtr = &(pool.mHead_d);
+        while (preLinkPtr->next != nullptr && MemBlock_e::to_node(preLinkPtr->next)->data < bytes) {
+            preLinkPtr = preLinkPtr->next;
+        }
+        if (preLinkPtr->next == nullptr) return nullptr;
+        MemBlock_e *mbPtr = MemBlock_e::to_node(preLinkPtr->next);
+        preLinkPtr->next = mbPtr->link.next;
+        pool.insert_d(reinterpret_cast<char *>(mbPtr) + bytes, mbPtr->data - bytes);
+        return mbPtr;
+    }
+
+    static bool deallocate(void *addr, int bytes) {
+        Instance_().insert_d(addr, MEM_ALIGN_ROUND_UP_(bytes));
+        return true;
+    }
+
+private:
+    FirstFitMemPool() : mHead_d { nullptr } { insert_d(mMemoryPool_d, MEMORY_SIZE); }
+
+    static FirstFitMemPool & Instance_() {
+        static FirstFitMemPool pool;
+        return pool;
+    }
+
+    static int MEM_ALIGN_ROUND_UP_(int bytes) {
+        return (bytes + SMA_MEM_ALIGN - 1) & ~(SMA_MEM_ALIGN - 1);
+    }
+
+    void insert_d(void *addr, int size) {
+        if (size <= 0) return;
+        Link_e *linkPtr = &mHead_d;
+        while (linkPtr->next != nullptr && addr > linkPtr->next) {
+            linkPtr = linkPtr->next;
+        }
+        Link_e::add(linkPtr, static_cast<Link_e *>(addr));
+        MemBlock_e::to_node(linkPtr->next)->data = size;
+    }
+
+    Link_e mHead_d;
+    alignas(SMA_MEM_ALIGN) char mMemoryPool_d[MEMORY_SIZE];
+};
+
+/*
+fragmented 1M pool:
+    | 200(free) | 136(used) | 200(free) | 136(used) | ...... | remain(free) |
+request 1024 byte, only the remain block is big enough
+*/
+template <typename SMA>
+static void bench_fragmented_pool(const char *name) {
+    const int holeSize = 200, usedSize = 136, requestSize = 1024, rounds = 10000;
+
+    dstruct::Vector<void *> holes, useds;
+    while (holes.size() < 2800) {
+        holes.push_back(SMA::allocate(holeSize));
+        useds.push_back(SMA::allocate(usedSize));
+    }
+
+    for (auto ptr : holes) SMA::deallocate(ptr, holeSize);
+
+    bench::Latency latency;
+    for (int i = 0; i < rounds; i++) {
+        void *ptr = nullptr;
+        latency.record([&] { ptr = SMA::allocate(requestSize); });
+        DSTRUCT_ASSERT(ptr != nullptr);
+        SMA::deallocate(ptr, requestSize);
+    }
+
+    BENCH_LOG("%-28s holes %llu, allocate(%d): max %6lld ns, avg %8.1f ns",
+        name, holes.size(), requestSize, latency.max_ns(), latency.avg_ns());
+
+    for (auto ptr : useds) SMA::deallocate(ptr, usedSize);
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    bench_fragmented_pool<FirstFitMemPool<MEM_1M_BYTE>>("first-fit(previous)");
+    bench_fragmented_pool<dstruct::StaticMemAllocator<MEM_1M_BYTE>>("StaticMemAllocator");
+    bench_fragmented_pool<dstruct::BoundaryTagMemAllocator<MEM_1M_BYTE>>("BoundaryTagMemAllocator");
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include "BenchBase.hpp"
+
+constexpr int ROUNDS = 1000000;
+
+struct CountAlloc {
+    static int allocateCnt;
+
+    static void * allocate(int bytes) {
+        allocateCnt++;
+        return dstruct::Alloc::allocate(bytes);
+    }
+
+    static void deallocate(void *addr, int bytes) {
+        dstruct::Alloc::deallocate(addr, bytes);
+    }
+};
+
+int CountAlloc::allocateCnt = 0;
+
+// short-lived container with a few elements, e.g. a local list of neighbors
+template <typename VectorType>
+static void bench_short_lived(const char *name, int elemNum) {
+    CountAlloc::allocateCnt = 0;
+    long long sum = 0;
+    bench::Timer timer;
+    for (int r = 0; r < ROUNDS; r++) {
+        VectorType vec;
+        for (int i = 0; i < elemNum; i++) vec.push_back(i + r);
+        for (auto v : vec) sum += v;
+    }
+    bench::do_not_optimize(sum);
+    BENCH_LOG("%-26s %2d elements x %d: allocate %8d times, %8.2f ms",
+        name, elemNum, ROUNDS, CountAlloc::allocateCnt, timer.elapsed_ms());
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    const int elemNums[] = { 2, 8, 16 };
+    for (int elemNum : elemNums) {
+        bench_short_lived<dstruct::Vector<int, CountAlloc>>("Vector<int>", elemNum);
+        bench_short_lived<dstruct::SmallVector<int, 8, CountAlloc>>("SmallVector<int, 8>", elemNum);
+    }
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <algorithm>
+
+#include "BenchBase.hpp"
+
+constexpr int OBJ_NUM = 2000000;
+
+enum Pattern { RANDOM, SORTED, REVERSED, ORGAN_PIPE, FEW_UNIQUE, PATTERN_NUM };
+
+static const char *patternNames[] = { "random", "sorted", "reversed", "organ pipe", "few unique(16)" };
+
+static void gen_pattern(dstruct::Vector<int> &vec, int pattern) {
+    unsigned long long seed = 2023;
+    vec.clear();
+    for (int i = 0; i < OBJ_NUM; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        int val = 0;
+        switch (pattern) {
+            case RANDOM:     val = static_cast<int>(seed >> 33); break;
+            case SORTED:     val = i; break;
+            case REVERSED:   val = OBJ_NUM - i; break;
+            case ORGAN_PIPE: val = i < OBJ_NUM / 2 ? i : OBJ_NUM - i; break;
+            default:         val = static_cast<int>((seed >> 33) % 16); break;
+        }
+        vec.push_back(val);
+    }
+}
+
+template <typename SortFunc>
+static double bench_sort(const dstruct::Vector<int> &input, SortFunc sortFunc) {
+    dstruct::Vector<int> data(input);
+    int *first = &data[0];
+
+    bench::Timer timer;
+    sortFunc(first, first + OBJ_NUM);
+    double ms = timer.elapsed_ms();
+
+    for (int i = 1; i < OBJ_NUM; i++) DSTRUCT_ASSERT(!(first[i] < first[i - 1]));
+    bench::do_not_optimize(first[OBJ_NUM / 2]);
+
+    return ms;
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+    printf("int x %d\n", OBJ_NUM);
+
+    dstruct::Vector<int> input;
+    for (int pattern = 0; pattern < PATTERN_NUM; pattern++) {
+        gen_pattern(input, pattern);
+        printf("\n%s\n", patternNames[pattern]);
+
+        BENCH_LOG("%-32s %8.2f ms", "std::sort",
+            bench_sort(input, [](int *first, int *last) { std::sort(first, last); }));
+        BENCH_LOG("%-32s %8.2f ms", "dstruct::algorithm::sort",
+            bench_sort(input, [](int *first, int *last) { dstruct::algorithm::sort(first, last); }));
+        BENCH_LOG("%-32s %8.2f ms", "std::stable_sort",
+            bench_sort(input, [](int *first, int *last) { std::stable_sort(first, last); }));
+        BENCH_LOG("%-32s %8.2f ms", "dstruct::algorithm::stable_sort",
+            bench_sort(input, [](int *first, int *last) { dstruct::algorithm::stable_sort(first, last); }));
+        BENCH_LOG("%-32s %8.2f ms", "algorithm heapsort",
+            bench_sort(input, [](int *first, int *last) {
+                dstruct::algorithm::make_heap(first, last);
+                dstruct::algorithm::sort_heap(first, last);
+            }));
+    }
+
+    gen_pattern(input, RANDOM);
+    printf("\nnth_element(median), random\n");
+    dstruct::Vector<int> data(input);
+    bench::Timer stdTimer;
+    std::nth_element(&data[0], &data[0] + OBJ_NUM / 2, &data[0] + OBJ_NUM);
+    BENCH_LOG("%-32s %8.2f ms", "std::nth_element", stdTimer.elapsed_ms());
+    int stdMedian = data[OBJ_NUM / 2];
+
+    data = input;
+    bench::Timer dstructTimer;
+    dstruct::algorithm::nth_element(data.begin(), data.begin() + OBJ_NUM / 2, data.end());
+    BENCH_LOG("%-32s %8.2f ms", "dstruct::algorithm::nth_element", dstructTimer.elapsed_ms());
+    DSTRUCT_ASSERT(data[OBJ_NUM / 2] == stdMedian);
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <mutex>
+#include <thread>
+
+#include "BenchBase.hpp"
+
+constexpr int OBJ_NUM = 10000000;
+constexpr int PING_PONG_NUM = 200000;
+constexpr int BATCH_SIZE = 32;
+constexpr int QUEUE_SIZE = 4096;
+
+// baseline: dstruct::Queue with a mutex, same try-push/try-pop interface
+template <typename T>
+struct MutexQueue {
+    bool push(const T &obj) {
+        std::lock_guard<std::mutex> guard(mMutex_d);
+        if (mQueue_d.size() == QUEUE_SIZE) return false;
+        mQueue_d.push(obj);
+        return true;
+    }
+
+    bool pop(T &obj) {
+        std::lock_guard<std::mutex> guard(mMutex_d);
+        if (mQueue_d.empty()) return false;
+        obj = mQueue_d.front();
+        mQueue_d.pop();
+        return true;
+    }
+
+    std::mutex mMutex_d;
+    dstruct::Queue<T> mQueue_d;
+};
+
+template <typename QueueType>
+static void bench_throughput(const char *name, QueueType &queue) {
+    long long sum = 0;
+    bench::Timer timer;
+
+    std::thread producer([&] {
+        for (int i = 0; i < OBJ_NUM; i++) {
+            while (!queue.push(i)) std::this_thread::yield();
+        }
+    });
+
+    for (int i = 0; i < OBJ_NUM; i++) {
+        int val;
+        while (!queue.pop(val)) std::this_thread::yield();
+        sum += val;
+    }
+
+    producer.join();
+    bench::do_not_optimize(sum);
+    BENCH_LOG("%-28s throughput: %6.2f M ops/s", name, OBJ_NUM / (timer.elapsed_ns() / 1000.0));
+}
+
+static void bench_batch_throughput(const char *name, dstruct::SPSCQueue<int, QUEUE_SIZE> &queue) {
+    long long sum = 0;
+    bench::Timer timer;
+
+    std::thread producer([&] {
+        int objs[BATCH_SIZE];
+        for (int i = 0; i < OBJ_NUM; ) {
+            for (int j = 0; j < BATCH_SIZE; j++) objs[j] = i + j;
+            int n = OBJ_NUM - i < BATCH_SIZE ? OBJ_NUM - i : BATCH_SIZE;
+            int pushed = queue.push_n(objs, n);
+            if (pushed == 0) std::this_thread::yield();
+            i += pushed;
+        }
+    });
+
+    int objs[BATCH_SIZE];
+    for (int i = 0; i < OBJ_NUM; ) {
+        int n = queue.pop_n(objs, BATCH_SIZE);
+        if (n == 0) std::this_thread::yield();
+        for (int j = 0; j < n; j++) sum += objs[j];
+        i += n;
+    }
+
+    producer.join();
+    bench::do_not_optimize(sum);
+    BENCH_LOG("%-28s throughput: %6.2f M ops/s", name, OBJ_NUM / (timer.elapsed_ns() / 1000.0));
+}
+
+// round-trip latency: ping thread -> pong thread -> ping thread
+template <typename QueueType>
+static void bench_latency(const char *name, QueueType &pingQueue, QueueType &pongQueue) {
+    std::thread pong([&] {
+        for (int i = 0; i < PING_PONG_NUM; i++) {
+            int val;
+            while (!pingQueue.pop(val)) std::this_thread::yield();
+            while (!pongQueue.push(val)) std::this_thread::yield();
+        }
+    });
+
+    bench::Timer timer;
+    for (int i = 0; i < PING_PONG_NUM; i++) {
+        int val;
+        while (!pingQueue.push(i)) std::this_thread::yield();
+        while (!pongQueue.pop(val)) std::this_thread::yield();
+    }
+    double rttNs = timer.elapsed_ns() / static_cast<double>(PING_PONG_NUM);
+
+    pong.join();
+    BENCH_LOG("%-28s round-trip latency: %8.1f ns", name, rttNs);
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    static dstruct::SPSCQueue<int, QUEUE_SIZE> spsc1, spsc2;
+    static MutexQueue<int> mutexQueue1, mutexQueue2;
+
+    bench_throughput("mutex + dstruct::Queue", mutexQueue1);
+    bench_throughput("SPSCQueue push/pop", spsc1);
+    bench_batch_throughput("SPSCQueue push_n/pop_n(32)", spsc1);
+
+    bench_latency("mutex + dstruct::Queue", mutexQueue1, mutexQueue2);
+    bench_latency("SPSCQueue", spsc1, spsc2);
+
+    return 0;
+}
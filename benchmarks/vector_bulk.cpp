@@ -0,0 +1,90 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include "BenchBase.hpp"
+
+constexpr int RECORD_NUM = 1000000;
+
+struct CountAlloc {
+    static int allocateCnt;
+
+    static void * allocate(int bytes) {
+        allocateCnt++;
+        return dstruct::Alloc::allocate(bytes);
+    }
+
+    static void deallocate(void *addr, int bytes) {
+        dstruct::Alloc::deallocate(addr, bytes);
+    }
+};
+
+int CountAlloc::allocateCnt = 0;
+
+struct Record {
+    int id;
+    double score;
+    char tag[16];
+};
+
+template <typename T>
+static void bench_load(const char *name, const dstruct::Vector<T> &records) {
+    {
+        CountAlloc::allocateCnt = 0;
+        bench::Timer timer;
+        dstruct::Vector<T, CountAlloc> vec;
+        for (auto it = records.begin(); it != records.end(); ++it) {
+            vec.push_back(*it);
+        }
+        bench::do_not_optimize(vec.back());
+        BENCH_LOG("%-8s push_back loop: allocate %3d times, %8.2f ms",
+            name, CountAlloc::allocateCnt, timer.elapsed_ms());
+    }
+    {
+        CountAlloc::allocateCnt = 0;
+        bench::Timer timer;
+        dstruct::Vector<T, CountAlloc> vec;
+        vec.append(records.begin(), records.end());
+        bench::do_not_optimize(vec.back());
+        BENCH_LOG("%-8s append:         allocate %3d times, %8.2f ms",
+            name, CountAlloc::allocateCnt, timer.elapsed_ms());
+    }
+    {
+        bench::Timer timer;
+        dstruct::Vector<T, CountAlloc> vec;
+        vec.append(records.begin(), records.begin() + RECORD_NUM / 2);
+        // insert the second half at the front: tail moved in bulk once
+        vec.insert(vec.begin(), records.begin() + RECORD_NUM / 2, records.end());
+        vec.erase(vec.begin(), vec.begin() + RECORD_NUM / 4);
+        bench::do_not_optimize(vec.back());
+        BENCH_LOG("%-8s insert + erase:                     %8.2f ms", name, timer.elapsed_ms());
+    }
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    dstruct::Vector<int> ints;
+    dstruct::Vector<Record> records;
+    dstruct::Vector<dstruct::String> strs;
+    ints.reserve(RECORD_NUM);
+    records.reserve(RECORD_NUM);
+    strs.reserve(RECORD_NUM);
+    for (int i = 0; i < RECORD_NUM; i++) {
+        ints.push_back(i);
+        records.push_back(Record { i, i * 0.5, "record" });
+        strs.push_back("string-record-no-sso");
+    }
+
+    bench_load("int", ints);
+    bench_load("Record", records);
+    bench_load("String", strs);
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include "BenchBase.hpp"
+
+constexpr int ELEMENT_NUM = 200000;
+
+// only copyable: growth deep-copy nested buffer (the previous Vector behavior)
+template <typename T>
+struct CopyOnly {
+    T data;
+
+    CopyOnly(const T &d) : data { d } { }
+    CopyOnly(const CopyOnly &c) : data { c.data } { }
+    CopyOnly & operator=(const CopyOnly &c) { data = c.data; return *this; }
+};
+
+template <typename T>
+static double bench_push_back(const T &element) {
+    bench::Timer timer;
+    dstruct::Vector<T> vec;
+    for (int i = 0; i < ELEMENT_NUM; i++) {
+        vec.push_back(element);
+    }
+    bench::do_not_optimize(vec.size());
+    return timer.elapsed_ms();
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    dstruct::Vector<int> vec(16, 1);
+    BENCH_LOG("Vector<Vector<int>>  push_back %d: deep-copy growth %8.2f ms, relocate growth %8.2f ms",
+        ELEMENT_NUM, bench_push_back(CopyOnly<dstruct::Vector<int>>(vec)), bench_push_back(vec));
+
+    dstruct::String str("a string with heap buffer");
+    BENCH_LOG("Vector<String>       push_back %d: deep-copy growth %8.2f ms, relocate growth %8.2f ms",
+        ELEMENT_NUM, bench_push_back(CopyOnly<dstruct::String>(str)), bench_push_back(str));
+
+    return 0;
+}
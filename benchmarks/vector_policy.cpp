@@ -0,0 +1,84 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include "BenchBase.hpp"
+
+constexpr int MAX_SIZE = 4096;
+constexpr int ROUNDS = 2000;
+// near shrink threshold: 600 -> capacity 1024, 300 is below 1/3 but above 1/4 of it
+constexpr int SWING_HIGH = 600;
+constexpr int SWING_LOW = 300;
+constexpr int SWING_ROUNDS = 20000;
+
+struct CountAlloc {
+    static int allocateCnt;
+
+    static void * allocate(int bytes) {
+        allocateCnt++;
+        return dstruct::Alloc::allocate(bytes);
+    }
+
+    static void deallocate(void *addr, int bytes) {
+        dstruct::Alloc::deallocate(addr, bytes);
+    }
+};
+
+int CountAlloc::allocateCnt = 0;
+
+// full cycle workload: fill to MAX_SIZE, then drain to 0, repeat
+template <typename Policy>
+static void bench_fill_drain(const char *name) {
+    CountAlloc::allocateCnt = 0;
+    bench::Timer timer;
+    {
+        dstruct::Vector<int, CountAlloc, Policy> vec;
+        for (int r = 0; r < ROUNDS; r++) {
+            for (int i = 0; i < MAX_SIZE; i++) vec.push_back(i);
+            while (!vec.empty()) vec.pop_back();
+        }
+    }
+    BENCH_LOG("%-34s fill/drain %d x %d: allocate %6d times, %8.2f ms",
+        name, MAX_SIZE, ROUNDS, CountAlloc::allocateCnt, timer.elapsed_ms());
+}
+
+// oscillating workload near the shrink threshold: pop to SWING_LOW, push back to SWING_HIGH, repeat
+template <typename Policy>
+static void bench_swing(const char *name) {
+    CountAlloc::allocateCnt = 0;
+    bench::Timer timer;
+    {
+        dstruct::Vector<int, CountAlloc, Policy> vec;
+        for (int i = 0; i < SWING_HIGH; i++) vec.push_back(i);
+        for (int r = 0; r < SWING_ROUNDS; r++) {
+            while (static_cast<int>(vec.size()) > SWING_LOW) vec.pop_back();
+            while (static_cast<int>(vec.size()) < SWING_HIGH) vec.push_back(r);
+        }
+    }
+    BENCH_LOG("%-34s swing %d <-> %d x %d: allocate %6d times, %8.2f ms",
+        name, SWING_HIGH, SWING_LOW, SWING_ROUNDS, CountAlloc::allocateCnt, timer.elapsed_ms());
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+
+    bench_fill_drain<dstruct::vector::GeometricPolicy<2, 1, 3>>("x2, shrink < 1/3 (previous)");
+    bench_fill_drain<dstruct::vector::DefaultPolicy>("x2, shrink < 1/4 (DefaultPolicy)");
+    bench_fill_drain<dstruct::vector::Growth1_5xPolicy>("x1.5, shrink < 1/4 (Growth1_5x)");
+    bench_fill_drain<dstruct::vector::NoShrinkPolicy>("x2, no auto-shrink (NoShrink)");
+
+    printf("\n");
+
+    bench_swing<dstruct::vector::GeometricPolicy<2, 1, 3>>("x2, shrink < 1/3 (previous)");
+    bench_swing<dstruct::vector::DefaultPolicy>("x2, shrink < 1/4 (DefaultPolicy)");
+    bench_swing<dstruct::vector::Growth1_5xPolicy>("x1.5, shrink < 1/4 (Growth1_5x)");
+    bench_swing<dstruct::vector::NoShrinkPolicy>("x2, no auto-shrink (NoShrink)");
+
+    return 0;
+}
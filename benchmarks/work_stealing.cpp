@@ -0,0 +1,135 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "BenchBase.hpp"
+
+constexpr unsigned int DATA_SIZE = 1 << 22;
+constexpr unsigned int GRAIN = 256; // leaf task size
+
+struct Task {
+    unsigned int begin, end;
+};
+
+// baseline: one dstruct::Deque shared by all workers with a mutex
+struct MutexScheduler {
+    MutexScheduler(int) { }
+
+    void push(int, const Task &task) {
+        std::lock_guard<std::mutex> guard(mMutex_d);
+        mDeque_d.push_back(task);
+    }
+
+    bool take(int, Task &task) {
+        std::lock_guard<std::mutex> guard(mMutex_d);
+        if (mDeque_d.empty()) return false;
+        task = mDeque_d.back();
+        mDeque_d.pop_back();
+        return true;
+    }
+
+    std::mutex mMutex_d;
+    dstruct::Deque<Task> mDeque_d;
+};
+
+// a WorkStealingDeque per worker, pop own tasks and steal others'
+struct StealingScheduler {
+    static constexpr int MAX_WORKER_NUM = 8;
+
+    StealingScheduler(int workerNum) : mWorkerNum_d { workerNum } {
+        DSTRUCT_ASSERT(workerNum <= MAX_WORKER_NUM);
+    }
+
+    void push(int id, const Task &task) {
+        mDeques_d[id].push(task);
+    }
+
+    bool take(int id, Task &task) {
+        if (mDeques_d[id].pop(task)) return true;
+        int n = mWorkerNum_d;
+        for (int i = 1; i < n; i++) {
+            if (mDeques_d[(id + i) % n].steal(task)) return true;
+        }
+        return false;
+    }
+
+    int mWorkerNum_d;
+    // by value: plain new doesn't honor the cache line alignment of the deque in c++11
+    dstruct::WorkStealingDeque<Task> mDeques_d[MAX_WORKER_NUM];
+};
+
+template <typename Scheduler>
+static void worker(Scheduler *scheduler, int id, dstruct::Vector<int> *data, std::atomic<unsigned int> *doneNum) {
+    Task task;
+    while (doneNum->load(std::memory_order_acquire) < DATA_SIZE) {
+        if (!scheduler->take(id, task)) {
+            std::this_thread::yield();
+            continue;
+        }
+        // fork: split down to GRAIN, keep the left half
+        while (task.end - task.begin > GRAIN) {
+            unsigned int mid = task.begin + (task.end - task.begin) / 2;
+            scheduler->push(id, Task { mid, task.end });
+            task.end = mid;
+        }
+        dstruct::algorithm::for_each(data->begin() + task.begin, data->begin() + task.end,
+            [](int &obj) { obj = obj * 7 + 3; }
+        );
+        doneNum->fetch_add(task.end - task.begin, std::memory_order_release);
+    }
+}
+
+template <typename Scheduler>
+static double bench_scaling(int workerNum, dstruct::Vector<int> &data) {
+    Scheduler scheduler(workerNum);
+    std::atomic<unsigned int> doneNum { 0 };
+    dstruct::Vector<std::thread *> threads;
+
+    bench::Timer timer;
+    scheduler.push(0, Task { 0, DATA_SIZE });
+    for (int i = 1; i < workerNum; i++) {
+        threads.push_back(new std::thread(worker<Scheduler>, &scheduler, i, &data, &doneNum));
+    }
+    worker<Scheduler>(&scheduler, 0, &data, &doneNum);
+    for (auto t : threads) {
+        t->join();
+        delete t;
+    }
+    double ms = timer.elapsed_ns() / 1000000.0;
+
+    bench::do_not_optimize(data[DATA_SIZE / 2]);
+    return ms;
+}
+
+int main() {
+
+    printf("\nBenchmark: %s\n", __FILE__);
+    printf("threads: %u, elements: %u, leaf task: %u (%u tasks)\n",
+        std::thread::hardware_concurrency(), DATA_SIZE, GRAIN, DATA_SIZE / GRAIN);
+
+    dstruct::Vector<int> data(DATA_SIZE, 1);
+
+    double mutexBase = 0, stealingBase = 0;
+    const int workerNums[] = { 1, 2, 4, 8 };
+    for (int workerNum : workerNums) {
+        double mutexMs = bench_scaling<MutexScheduler>(workerNum, data);
+        double stealingMs = bench_scaling<StealingScheduler>(workerNum, data);
+        if (workerNum == 1) {
+            mutexBase = mutexMs;
+            stealingBase = stealingMs;
+        }
+        BENCH_LOG("W%-2d: mutex + dstruct::Deque %8.2f ms (x%.2f) | WorkStealingDeque %8.2f ms (x%.2f)",
+            workerNum, mutexMs, mutexBase / mutexMs, stealingMs, stealingBase / stealingMs);
+    }
+
+    return 0;
+}
@@ -10,7 +10,8 @@
 #ifndef ALGORITHM_HPP_DSTRUCT
 #define ALGORITHM_HPP_DSTRUCT
 
-#include <core/utils.hpp>
+#include <core/common.hpp>
+
 namespace dstruct {
 
 namespace algorithm {
@@ -31,6 +32,481 @@ namespace algorithm {
         }
         return end;
     }
+
+/*
+heap: [first, last) as a 0-indexed binary heap, same as std - cmp(a, b) is "a < b", the biggest at first
+      (note: dstruct::Heap's Compare is cmp(parent, child), e.g. MinHeap is less)
+
+    make_heap / pop_heap / partial_sort use Floyd's bottom-up sift:
+        move the hole down to a leaf by the bigger child(1 cmp per level), then sift obj up from there,
+        the moved-down obj is usually small and stops near the leaf - about half cmp of top-down sift
+    all in-place, iterator(by value, T * / array is ok) need: it + n, last - first, *it
+    e.g. PrimitiveIterator(Vector, Array), T *
+*/
+
+    struct Less_ {
+        template <typename T>
+        bool operator()(const T &a, const T &b) const {
+            return a < b;
+        }
+    };
+
+    // hole at index hole, move parents down until obj fit
+    template <typename Iterator, typename T, typename Compare>
+    static void _heap_sift_up(const Iterator &first, long long hole, long long top, T &obj, Compare &cmp) {
+        long long parent = (hole - 1) / 2;
+        while (hole > top && cmp(*(first + parent), obj)) {
+            *(first + hole) = dstruct::move(*(first + parent));
+            hole = parent;
+            parent = (hole - 1) / 2;
+        }
+        *(first + hole) = dstruct::move(obj);
+    }
+
+    // Floyd: hole at index hole down to a leaf, then put obj back on the path
+    template <typename Iterator, typename T, typename Compare>
+    static void _heap_adjust(const Iterator &first, long long hole, long long len, T &obj, Compare &cmp) {
+        long long top = hole;
+        long long child = 2 * hole + 2; // right child
+        while (child < len) {
+            if (cmp(*(first + child), *(first + (child - 1)))) child--;
+            *(first + hole) = dstruct::move(*(first + child));
+            hole = child;
+            child = 2 * child + 2;
+        }
+        if (child == len) { // only left child
+            *(first + hole) = dstruct::move(*(first + (child - 1)));
+            hole = child - 1;
+        }
+        _heap_sift_up(first, hole, top, obj, cmp);
+    }
+
+    // bottom-up heapify - O(n)
+    template <typename Iterator, typename Compare>
+    static void make_heap(Iterator first, Iterator last, Compare cmp) {
+        long long len = last - first;
+        for (long long parent = (len - 2) / 2; len >= 2 && parent >= 0; parent--) {
+            auto obj = dstruct::move(*(first + parent));
+            _heap_adjust(first, parent, len, obj, cmp);
+        }
+    }
+
+    // [first, last - 1) is heap, push *(last - 1) into it
+    template <typename Iterator, typename Compare>
+    static void push_heap(Iterator first, Iterator last, Compare cmp) {
+        long long len = last - first;
+        if (len < 2) return;
+        auto obj = dstruct::move(*(first + (len - 1)));
+        _heap_sift_up(first, len - 1, 0, obj, cmp);
+    }
+
+    // move the biggest to last - 1, [first, last - 1) is still a heap
+    template <typename Iterator, typename Compare>
+    static void pop_heap(Iterator first, Iterator last, Compare cmp) {
+        long long len = last - first;
+        if (len < 2) return;
+        auto obj = dstruct::move(*(first + (len - 1)));
+        *(first + (len - 1)) = dstruct::move(*first);
+        _heap_adjust(first, 0, len - 1, obj, cmp);
+    }
+
+    // heap -> sorted(ascending by cmp)
+    template <typename Iterator, typename Compare>
+    static void sort_heap(Iterator first, Iterator last, Compare cmp) {
+        for (long long len = last - first; len > 1; len--) {
+            algorithm::pop_heap(first, first + len, cmp);
+        }
+    }
+
+    template <typename Iterator, typename Compare>
+    static bool is_heap(Iterator first, Iterator last, Compare cmp) {
+        long long len = last - first;
+        for (long long child = 1; child < len; child++) {
+            if (cmp(*(first + (child - 1) / 2), *(first + child))) return false;
+        }
+        return true;
+    }
+
+    // the smallest middle - first objs of [first, last) to [first, middle) in order, others unspecified
+    template <typename Iterator, typename Compare>
+    static void partial_sort(Iterator first, Iterator middle, Iterator last, Compare cmp) {
+        long long heapLen = middle - first;
+        if (heapLen == 0) return;
+
+        algorithm::make_heap(first, middle, cmp); // max-heap of the current smallest
+        for (auto it = middle; it != last; it++) {
+            if (cmp(*it, *first)) {
+                auto obj = dstruct::move(*it);
+                *it = dstruct::move(*first);
+                _heap_adjust(first, 0, heapLen, obj, cmp);
+            }
+        }
+        algorithm::sort_heap(first, middle, cmp);
+    }
+
+    template <typename Iterator>
+    static void make_heap(Iterator first, Iterator last) {
+        algorithm::make_heap(first, last, Less_());
+    }
+
+    template <typename Iterator>
+    static void push_heap(Iterator first, Iterator last) {
+        algorithm::push_heap(first, last, Less_());
+    }
+
+    template <typename Iterator>
+    static void pop_heap(Iterator first, Iterator last) {
+        algorithm::pop_heap(first, last, Less_());
+    }
+
+    template <typename Iterator>
+    static void sort_heap(Iterator first, Iterator last) {
+        algorithm::sort_heap(first, last, Less_());
+    }
+
+    template <typename Iterator>
+    static bool is_heap(Iterator first, Iterator last) {
+        return algorithm::is_heap(first, last, Less_());
+    }
+
+    template <typename Iterator>
+    static void partial_sort(Iterator first, Iterator middle, Iterator last) {
+        algorithm::partial_sort(first, middle, last, Less_());
+    }
+/*
+sort: pattern-defeating quicksort(pdqsort), O(n log n) worst, not stable
+
+    len < 24:    insertion sort(unguarded if it isn't the leftmost range)
+    pivot:       median of 3, ninther(median of 3 medians) if len > 128, moved to first
+    partition:   objs < pivot | pivot | objs >= pivot
+    patterns:
+        pivot == the obj before the range(previous pivot) -> many equal objs,
+                     put objs == pivot left and skip them - O(n) for few distinct keys
+        no swap in partition -> maybe sorted, try insertion sort with a move limit
+        unbalanced(a side < len / 8) -> swap some objs to break the pattern,
+                     after log2(len) unbalanced partitions, heapsort the range
+    recurse the smaller side, loop the bigger one - O(log n) stack
+
+stable_sort: top-down merge sort with a len / 2 buffer from dstruct::Alloc
+nth_element: quickselect with the same partition, heapselect(partial_sort) if it goes bad
+*/
+
+    template <typename Iterator, typename Compare>
+    static void _sort2(Iterator a, Iterator b, Compare &cmp) {
+        if (cmp(*b, *a)) dstruct::swap(*a, *b);
+    }
+
+    template <typename Iterator, typename Compare>
+    static void _sort3(Iterator a, Iterator b, Iterator c, Compare &cmp) {
+        _sort2(a, b, cmp);
+        _sort2(b, c, cmp);
+        _sort2(a, b, cmp);
+    }
+
+    template <typename Iterator, typename Compare>
+    static void _insertion_sort(Iterator first, Iterator last, Compare &cmp) {
+        if (first == last) return;
+        for (Iterator curr = first + 1; curr != last; ++curr) {
+            Iterator hole = curr, prev = curr;
+            --prev;
+            if (cmp(*curr, *prev)) {
+                auto obj = dstruct::move(*curr);
+                do {
+                    *hole = dstruct::move(*prev);
+                    --hole;
+                } while (hole != first && cmp(obj, *--prev));
+                *hole = dstruct::move(obj);
+            }
+        }
+    }
+
+    // request: the obj before first isn't greater than any obj of [first, last)
+    template <typename Iterator, typename Compare>
+    static void _unguarded_insertion_sort(Iterator first, Iterator last, Compare &cmp) {
+        if (first == last) return;
+        for (Iterator curr = first + 1; curr != last; ++curr) {
+            Iterator hole = curr, prev = curr;
+            --prev;
+            if (cmp(*curr, *prev)) {
+                auto obj = dstruct::move(*curr);
+                do {
+                    *hole = dstruct::move(*prev);
+                    --hole;
+                } while (cmp(obj, *--prev));
+                *hole = dstruct::move(obj);
+            }
+        }
+    }
+
+    // give up(return false) after moving more than 8 objs
+    template <typename Iterator, typename Compare>
+    static bool _partial_insertion_sort(Iterator first, Iterator last, Compare &cmp) {
+        if (first == last) return true;
+        long long moved = 0;
+        for (Iterator curr = first + 1; curr != last; ++curr) {
+            Iterator hole = curr, prev = curr;
+            --prev;
+            if (cmp(*curr, *prev)) {
+                auto obj = dstruct::move(*curr);
+                do {
+                    *hole = dstruct::move(*prev);
+                    --hole;
+                } while (hole != first && cmp(obj, *--prev));
+                *hole = dstruct::move(obj);
+                moved += curr - hole;
+                if (moved > 8) return false;
+            }
+        }
+        return true;
+    }
+
+    // pivot is *first, return its final position; objs == pivot go right
+    // request: an obj >= pivot at last - 1(median of 3 guarantee it)
+    template <typename Iterator, typename Compare>
+    static Iterator _partition_right(Iterator first, Iterator last, Compare &cmp, bool &alreadyPartitioned) {
+        auto pivot = dstruct::move(*first);
+        Iterator lo = first, hi = last;
+
+        while (cmp(*++lo, pivot));
+        if (lo - first == 1) {
+            while (lo != hi && !cmp(*--hi, pivot));
+        } else {
+            while (!cmp(*--hi, pivot)); // guard: an obj < pivot at left
+        }
+
+        alreadyPartitioned = !(hi - lo > 0);
+        while (hi - lo > 0) {
+            dstruct::swap(*lo, *hi);
+            while (cmp(*++lo, pivot));
+            while (!cmp(*--hi, pivot));
+        }
+
+        Iterator pivotPos = lo;
+        --pivotPos;
+        *first = dstruct::move(*pivotPos);
+        *pivotPos = dstruct::move(pivot);
+        return pivotPos;
+    }
+
+    // pivot is *first, objs == pivot go left
+    // request: the obj before first is == pivot(so no obj < pivot in range)
+    template <typename Iterator, typename Compare>
+    static Iterator _partition_left(Iterator first, Iterator last, Compare &cmp) {
+        auto pivot = dstruct::move(*first);
+        Iterator lo = first, hi = last;
+
+        while (cmp(pivot, *--hi));
+        if (last - hi == 1) {
+            while (lo != hi && !cmp(pivot, *++lo));
+        } else {
+            while (!cmp(pivot, *++lo));
+        }
+
+        while (hi - lo > 0) {
+            dstruct::swap(*lo, *hi);
+            while (cmp(pivot, *--hi));
+            while (!cmp(pivot, *++lo));
+        }
+
+        *first = dstruct::move(*hi);
+        *hi = dstruct::move(pivot);
+        return hi;
+    }
+
+    // pivot(median) to first
+    template <typename Iterator, typename Compare>
+    static void _choose_pivot(Iterator first, Iterator last, Compare &cmp) {
+        long long len = last - first, half = len / 2;
+        if (len > 128) {
+            _sort3(first, first + half, last - 1, cmp);
+            _sort3(first + 1, first + (half - 1), last - 2, cmp);
+            _sort3(first + 2, first + (half + 1), last - 3, cmp);
+            _sort3(first + (half - 1), first + half, first + (half + 1), cmp);
+            dstruct::swap(*first, *(first + half));
+        } else {
+            _sort3(first + half, first, last - 1, cmp);
+        }
+    }
+
+    template <typename Iterator, typename Compare>
+    static void _pdqsort_loop(Iterator first, Iterator last, Compare &cmp, int badAllowed, bool leftmost) {
+        while (true) {
+            long long len = last - first;
+            if (len < 24) {
+                if (leftmost) _insertion_sort(first, last, cmp);
+                else _unguarded_insertion_sort(first, last, cmp);
+                return;
+            }
+
+            _choose_pivot(first, last, cmp);
+
+            if (!leftmost && !cmp(*(first - 1), *first)) {
+                first = _partition_left(first, last, cmp) + 1;
+                continue;
+            }
+
+            bool alreadyPartitioned = false;
+            Iterator pivotPos = _partition_right(first, last, cmp, alreadyPartitioned);
+            long long leftLen = pivotPos - first;
+            long long rightLen = last - pivotPos - 1;
+
+            if (leftLen < len / 8 || rightLen < len / 8) {
+                if (--badAllowed == 0) {
+                    algorithm::make_heap(first, last, cmp);
+                    algorithm::sort_heap(first, last, cmp);
+                    return;
+                }
+
+                if (leftLen >= 24) {
+                    dstruct::swap(*first, *(first + leftLen / 4));
+                    dstruct::swap(*(pivotPos - 1), *(pivotPos - leftLen / 4));
+                    if (leftLen > 128) {
+                        dstruct::swap(*(first + 1), *(first + (leftLen / 4 + 1)));
+                        dstruct::swap(*(first + 2), *(first + (leftLen / 4 + 2)));
+                        dstruct::swap(*(pivotPos - 2), *(pivotPos - (leftLen / 4 + 1)));
+                        dstruct::swap(*(pivotPos - 3), *(pivotPos - (leftLen / 4 + 2)));
+                    }
+                }
+
+                if (rightLen >= 24) {
+                    dstruct::swap(*(pivotPos + 1), *(pivotPos + (1 + rightLen / 4)));
+                    dstruct::swap(*(last - 1), *(last - rightLen / 4));
+                    if (rightLen > 128) {
+                        dstruct::swap(*(pivotPos + 2), *(pivotPos + (2 + rightLen / 4)));
+                        dstruct::swap(*(pivotPos + 3), *(pivotPos + (3 + rightLen / 4)));
+                        dstruct::swap(*(last - 2), *(last - (1 + rightLen / 4)));
+                        dstruct::swap(*(last - 3), *(last - (2 + rightLen / 4)));
+                    }
+                }
+            } else if (alreadyPartitioned &&
+                _partial_insertion_sort(first, pivotPos, cmp) &&
+                _partial_insertion_sort(pivotPos + 1, last, cmp)) {
+                return;
+            }
+
+            if (leftLen < rightLen) {
+                _pdqsort_loop(first, pivotPos, cmp, badAllowed, leftmost);
+                first = pivotPos + 1;
+                leftmost = false;
+            } else {
+                _pdqsort_loop(pivotPos + 1, last, cmp, badAllowed, false);
+                last = pivotPos;
+            }
+        }
+    }
+
+    template <typename Iterator, typename Compare>
+    static void sort(Iterator first, Iterator last, Compare cmp) {
+        long long len = last - first;
+        if (len < 2) return;
+        int badAllowed = 0;
+        while (len > 1) { len >>= 1; badAllowed++; } // log2(len)
+        _pdqsort_loop(first, last, cmp, badAllowed, true);
+    }
+
+    // buffer: raw memory of (last - first) / 2 objs
+    template <typename Iterator, typename T, typename Compare>
+    static void _merge_sort(Iterator first, Iterator last, T *buffer, Compare &cmp) {
+        long long len = last - first;
+        if (len <= 16) {
+            _insertion_sort(first, last, cmp);
+            return;
+        }
+
+        long long leftLen = len / 2;
+        Iterator middle = first + leftLen;
+        _merge_sort(first, middle, buffer, cmp);
+        _merge_sort(middle, last, buffer, cmp);
+
+        if (!cmp(*middle, *(middle - 1))) return; // already in order
+
+        // move left half to buffer, merge back - take left one if equal(stable)
+        T *bufEnd = buffer;
+        for (Iterator it = first; it != middle; ++it, ++bufEnd) {
+            dstruct::construct(bufEnd, dstruct::move(*it));
+        }
+
+        T *left = buffer;
+        Iterator right = middle, out = first;
+        while (left != bufEnd && right != last) {
+            if (cmp(*right, *left)) {
+                *out = dstruct::move(*right);
+                ++right;
+            } else {
+                *out = dstruct::move(*left);
+                ++left;
+            }
+            ++out;
+        }
+        for (; left != bufEnd; ++left, ++out) {
+            *out = dstruct::move(*left);
+        }
+
+        for (T *it = buffer; it != bufEnd; ++it) {
+            dstruct::destroy(it);
+        }
+    }
+
+    template <typename Iterator, typename Compare>
+    static void stable_sort(Iterator first, Iterator last, Compare cmp) {
+        using T = typename RemoveReference<decltype(*first)>::Type;
+        using AllocT = AllocSpec<T, dstruct::Alloc>;
+
+        long long len = last - first;
+        if (len <= 16) {
+            _insertion_sort(first, last, cmp);
+            return;
+        }
+
+        int bufferLen = static_cast<int>(len / 2);
+        T *buffer = AllocT::allocate(bufferLen);
+        DSTRUCT_ASSERT(buffer != nullptr);
+        _merge_sort(first, last, buffer, cmp);
+        AllocT::deallocate(buffer, bufferLen);
+    }
+
+    // *nth is the obj in sorted position, [first, nth) <= *nth <= [nth + 1, last)
+    template <typename Iterator, typename Compare>
+    static void nth_element(Iterator first, Iterator nth, Iterator last, Compare cmp) {
+        if (nth == last) return;
+
+        int badAllowed = 0; // unbalanced partitions allowed, log2(len)
+        for (long long len = last - first; len > 1; len >>= 1) badAllowed++;
+
+        while (last - first >= 24) {
+            long long len = last - first;
+
+            _choose_pivot(first, last, cmp);
+            bool alreadyPartitioned = false;
+            Iterator pivotPos = _partition_right(first, last, cmp, alreadyPartitioned);
+
+            long long pivotIndex = pivotPos - first, nthIndex = nth - first;
+            if (nthIndex == pivotIndex) return;
+            if (nthIndex < pivotIndex) last = pivotPos;
+            else first = pivotPos + 1;
+
+            if ((pivotIndex < len / 8 || len - pivotIndex - 1 < len / 8) && --badAllowed == 0) {
+                algorithm::partial_sort(first, nth + 1, last, cmp); // heapselect
+                return;
+            }
+        }
+        _insertion_sort(first, last, cmp);
+    }
+
+    template <typename Iterator>
+    static void sort(Iterator first, Iterator last) {
+        algorithm::sort(first, last, Less_());
+    }
+
+    template <typename Iterator>
+    static void stable_sort(Iterator first, Iterator last) {
+        algorithm::stable_sort(first, last, Less_());
+    }
+
+    template <typename Iterator>
+    static void nth_element(Iterator first, Iterator nth, Iterator last) {
+        algorithm::nth_element(first, nth, last, Less_());
+    }
 }
 
 }
@@ -29,7 +29,9 @@ public: \
     using DifferenceType       = typename DStruct::DifferenceType; \
 public: \
     using IteratorType         = typename DStruct::IteratorType; \
-    using ConstIteratorType    = typename DStruct::ConstIteratorType;
+    using ConstIteratorType    = typename DStruct::ConstIteratorType; \
+public: \
+    using AllocType            = typename DStruct::AllocType;
 
 #define DSTRUCT_COPY_SEMANTICS(DStruct) \
     DStruct(const DStruct &ds) : DStruct() { *this = ds; } \
@@ -57,6 +59,14 @@ static T* construct(void *addr, const T& obj) noexcept {
     return new(addr, &placementNewFlag) T(obj); // use T's constructor(copy/spec)
 }
 
+// construct by args, e.g. move or emplace
+template <typename T, typename... Args>
+static T* construct(T *addr, Args&&... args) noexcept {
+    static DStructPlacementNewFlag placementNewFlag;
+    DSTRUCT_CRASH(addr == nullptr);
+    return new(addr, &placementNewFlag) T(dstruct::forward<Args>(args)...);
+}
+
 /*
 // partial specialization only for type, func template pls use overload
 template <typename T>
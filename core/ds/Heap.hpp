@@ -11,33 +11,62 @@
 #define HEAP_HPP_DSTRUCT
 
 #include <core/common.hpp>
+#include <core/algorithm.hpp>
 #include <core/ds/array/Vector.hpp>
 
 namespace dstruct {
 
-// Compare(parent, child) == true
-template <typename T, typename Compare, typename Alloc = dstruct::Alloc>
+/*
+Heap: Arity-ary heap on a Vector-like Storage, Compare(parent, child) == true
+
+    index: Arity - 1 virtual padding slots before root, so children of a node start at a multiple of Arity
+    storage: objs only(root at mHeap_d[0]), padding is never constructed, index - PADDING to access
+
+    Arity = 4:
+    +-----+-----+-----+------+-----+-----+-----+-----+-----+-----+-----+-----+----
+    | pad | pad | pad | root |  4  |  5  |  6  |  7  |  8  |  9  | 10  | 11  | ...
+    +-----+-----+-----+------+-----+-----+-----+-----+-----+-----+-----+-----+----
+                             |<- children of root  ->|<- children of 4     ->|
+
+    children of node p: [Arity * (p - Arity + 2), + Arity), parent of c: c / Arity + Arity - 2
+
+    Arity = 2: the classic 1-indexed binary heap
+    Arity = 4 + Storage start at (cache line - padding bytes)(see dstruct::DAryHeap) + Arity * sizeof(T) divides cache line:
+        all children of a node are in one cache line, pop() touch half levels of a binary heap
+
+    sift up/down move a "hole" instead of swap: one move per level, obj is put once at the end
+*/
+
+// Storage: Vector-like backing store, e.g. SmallVector<T, N, Alloc> for small heap
+template <typename T, typename Compare, typename Alloc = dstruct::Alloc,
+    typename Storage = dstruct::Vector<T, Alloc>, int Arity = 2>
 class Heap {
 
+    static_assert(Arity >= 2, "Arity < 2");
+
+    constexpr static int PADDING = Arity - 1; // index of root
+
 protected:
-    using Heap_ = dstruct::Vector<T, Alloc>;
+    using Heap_ = Storage;
 
     DSTRUCT_TYPE_SPEC_HELPER(Heap_)
 
 public:
-    Heap(const Compare &cmp = Compare(), const T &obj = T()) :
-        mCmp_d { cmp }, mHeap_d(1, obj) { }
+    Heap(const Compare &cmp = Compare()) : mCmp_d { cmp }, mHeap_d() { }
 
-    Heap(const IteratorType &begin, const IteratorType &end) : Heap() {
+    explicit Heap(Alloc &alloc, const Compare &cmp = Compare()) :
+        mCmp_d { cmp }, mHeap_d(alloc) { }
 
-        mHeap_d.resize(distance(begin, end) + 1);
+    // bulk load + heapify(bottom-up) - O(n)
+    Heap(const IteratorType &begin, const IteratorType &end) : Heap() {
 
-        for (auto it = begin; it != end; it++) {
-            mHeap_d.push_back(*it);
-        }
+        mHeap_d.reserve(distance(begin, end));
+        mHeap_d.append(begin, end);
 
-        for (int i = (mHeap_d.size() - 1) / 2; i >= 1; i--) {
-            _adjust_down(i);
+        if (mHeap_d.size() > 1) {
+            for (int i = _parent(mHeap_d.size() - 1 + PADDING); i >= PADDING; i--) {
+                _adjust_down(i);
+            }
         }
     }
 
@@ -52,7 +81,6 @@ public:
     Heap & operator=(Heap &&hep) {
         this->mCmp_d = hep.mCmp_d;
         this->mHeap_d = dstruct::move(hep.mHeap_d);
-        hep.mHeap_d.resize(1, this->mHeap_d[0]);
         return *this;
     }
 
@@ -61,25 +89,26 @@ public:
 public: // base op
     // status
     SizeType size() const {
-        return mHeap_d.size() - 1;
+        return mHeap_d.size();
     }
 
     SizeType capacity() const {
-        return mHeap_d.capacity() - 1;
+        return mHeap_d.capacity();
     }
 
     bool empty() const {
-        return mHeap_d.size() == 1;
+        return mHeap_d.empty();
     }
 
 
     // check
     ValueType top() const {
-        return mHeap_d[1];
+        return mHeap_d[0];
     }
 
+    // 1-based: heap[1] is top
     const ValueType & operator[](int index) {
-        return mHeap_d[index];
+        return mHeap_d[index - 1];
     }
 
 
@@ -89,21 +118,28 @@ public: // base op
         _adjust_up();
     }
 
+    void push(T &&obj) {
+        mHeap_d.push_back(dstruct::move(obj));
+        _adjust_up();
+    }
+
     void pop() {
-        // T data = mHeap_d[1];
-        // TODO: undefined or Vector?
-        //mHeap_d[1] = mHeap_d.pop_back(); // when pop_back resize, mHeap_d[1] will released
-        //mHeap_d[1] = dstruct::move(mHeap_d.back());
-        mHeap_d[1] = mHeap_d.back();
-        mHeap_d.pop_back();
-        _adjust_down(1);
-        // return data;
+        // move last to root, the old root is released by assignment
+        // (mHeap_d[0] = mHeap_d.pop_back() is undefined: pop_back may resize)
+        // Note: Vector::back() is const only, move(back()) would copy
+        if (mHeap_d.size() > 1) {
+            mHeap_d[0] = dstruct::move(mHeap_d[mHeap_d.size() - 1]);
+            mHeap_d.pop_back();
+            _adjust_down(PADDING);
+        } else {
+            mHeap_d.pop_back();
+        }
     }
 
 
     // iterator/range-for support
     ConstIteratorType begin() const {
-        return mHeap_d.begin() + 1;
+        return mHeap_d.begin();
     }
 
     ConstIteratorType end() const {
@@ -112,62 +148,81 @@ public: // base op
 
 public: // pub static
 
+    // heapify [begin, end) in-place(binary layout, top at begin), and return a Heap of it
     static Heap build(const IteratorType &begin, const IteratorType &end) {
-        Heap heap(begin, end);
-        auto heapIt = heap.begin();
-        for (auto it = begin; it != end; it++, heapIt++) {
-            *it = *heapIt;
-        }
-        return heap /*todo: dstruct::move(heap)*/;
+        algorithm::make_heap(begin, end, ReverseCompare_ { Compare() });
+        return Heap(begin, end); // heapify of a heap(Arity == 2) only compare
     }
 
+    // in-place heapsort, begin is top(e.g. MinHeap: ascending)
     static void sort(const IteratorType &begin, const IteratorType &end) {
-        Heap heap(begin, end);
-        for (auto it = begin; it != end; it++) {
-            *it = heap.top(); heap.pop();
-        }
+        algorithm::make_heap(begin, end, Compare());
+        algorithm::sort_heap(begin, end, Compare());
     }
 
 protected:
+    // algorithm's heap: cmp(a, b) is "a < b"(biggest at top), Heap: cmp(parent, child)
+    struct ReverseCompare_ {
+        Compare cmp;
+        bool operator()(const T &a, const T &b) { return cmp(b, a); }
+    };
+
     Compare mCmp_d;
     Heap_ mHeap_d;
 
+    static int _parent(int index) {
+        return index / Arity + Arity - 2;
+    }
+
+    static int _first_child(int index) {
+        return Arity * (index - Arity + 2);
+    }
+
+    // hole from the last slot up, move parents down into it
     void _adjust_up() {
-        int nodeIndex = mHeap_d.size() - 1;
-        while (nodeIndex > 1) {
-            int parent = nodeIndex / 2;
-            if (!mCmp_d(mHeap_d[parent], mHeap_d[nodeIndex])) {
-                dstruct::swap(mHeap_d[parent], mHeap_d[nodeIndex]);
-                nodeIndex = parent;
-            } else {
-                break;
-            }
+        int hole = mHeap_d.size() - 1 + PADDING;
+        if (hole == PADDING) return;
+
+        // contiguous storage, skip the index check in the loop. heap[i - PADDING]: obj of index i
+        T *heap = &mHeap_d[0];
+        T obj = dstruct::move(heap[hole - PADDING]);
+        while (hole > PADDING) {
+            int parent = _parent(hole);
+            if (mCmp_d(heap[parent - PADDING], obj)) break;
+            heap[hole - PADDING] = dstruct::move(heap[parent - PADDING]);
+            hole = parent;
         }
+        heap[hole - PADDING] = dstruct::move(obj);
     }
 
+    // hole from nodeIndex down, move the best child up into it
     void _adjust_down(int nodeIndex) {
-        int heapSize = mHeap_d.size();
-        int parent = nodeIndex;
-        int left, right;
-
-        while (true) {
-            int left = 2 * parent;
-            int right = left + 1;
-            int target = parent;
-
-            if (left < heapSize && !mCmp_d(mHeap_d[target], mHeap_d[left])) {
-                target = left;
-            }
-
-            if (right < heapSize && !mCmp_d(mHeap_d[target], mHeap_d[right])) {
-                target = right;
+        int heapSize = mHeap_d.size() + PADDING;
+        int hole = nodeIndex;
+        int child = _first_child(hole);
+        if (child >= heapSize) return;
+
+        T *heap = &mHeap_d[0];
+        T obj = dstruct::move(heap[hole - PADDING]);
+        while (child < heapSize) {
+            int target = child;
+            if (child + Arity <= heapSize) { // full group, fixed trip count
+                for (int i = 1; i < Arity; i++) {
+                    if (!mCmp_d(heap[target - PADDING], heap[child + i - PADDING])) target = child + i;
+                }
+            } else {
+                for (int i = child + 1; i < heapSize; i++) {
+                    if (!mCmp_d(heap[target - PADDING], heap[i - PADDING])) target = i;
+                }
             }
 
-            if (target == parent) break;
+            if (mCmp_d(obj, heap[target - PADDING])) break;
 
-            dstruct::swap(mHeap_d[parent], mHeap_d[target]);
-            parent = target;
+            heap[hole - PADDING] = dstruct::move(heap[target - PADDING]);
+            hole = target;
+            child = _first_child(hole);
         }
+        heap[hole - PADDING] = dstruct::move(obj);
     }
 };
 
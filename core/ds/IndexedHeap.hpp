@@ -0,0 +1,210 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef INDEXED_HEAP_HPP_DSTRUCT
+#define INDEXED_HEAP_HPP_DSTRUCT
+
+#include <core/common.hpp>
+#include <core/ds/array/Vector.hpp>
+
+namespace dstruct {
+
+/*
+IndexedHeap: addressable binary heap, push return a handle to update/erase the obj later
+
+    mHeap_d:  [ {obj, handle} {obj, handle} ... ]    heap order, 0 is top
+                                 ^
+    mPos_d:   [ 1, -1, 0, ... ]  | mPos_d[handle] == index in mHeap_d, -1: not in heap
+    mFreeHandles_d: handles released by pop/erase, reused by push
+
+    push/pop/update/erase: O(log n), top/contains/get: O(1)
+    sift up/down move a "hole", mPos_d is updated for every moved entry
+
+Note: a handle is invalid after its obj is popped/erased, and may be reused by the next push
+*/
+
+// Compare(parent, child) == true
+template <typename T, typename Compare, typename Alloc = dstruct::Alloc>
+class IndexedHeap {
+
+    struct Entry_ {
+        T obj;
+        int handle;
+    };
+
+public:
+    using ValueType            = T;
+    using ConstReferenceType   = const ValueType &;
+    using SizeType             = size_t;
+    using HandleType           = int;
+    using AllocType            = Alloc;
+
+public: // big five
+    IndexedHeap(const Compare &cmp = Compare()) : mCmp_d { cmp } { }
+
+    explicit IndexedHeap(Alloc &alloc, const Compare &cmp = Compare()) :
+        mCmp_d { cmp }, mHeap_d(alloc), mPos_d(alloc), mFreeHandles_d(alloc) { }
+
+    IndexedHeap(const IndexedHeap &) = default;
+    IndexedHeap & operator=(const IndexedHeap &) = default;
+
+    IndexedHeap(IndexedHeap &&) = default;
+    IndexedHeap & operator=(IndexedHeap &&) = default;
+
+    ~IndexedHeap() = default;
+
+public: // status
+    SizeType size() const {
+        return mHeap_d.size();
+    }
+
+    bool empty() const {
+        return mHeap_d.empty();
+    }
+
+    // handle is in heap(pushed, not popped/erased)
+    bool contains(HandleType handle) const {
+        return handle >= 0 && handle < static_cast<int>(mPos_d.size()) && mPos_d[handle] >= 0;
+    }
+
+public: // check
+    ConstReferenceType top() const {
+        return mHeap_d[0].obj;
+    }
+
+    HandleType top_handle() const {
+        return mHeap_d[0].handle;
+    }
+
+    ConstReferenceType operator[](HandleType handle) const {
+        DSTRUCT_ASSERT(contains(handle));
+        return mHeap_d[mPos_d[handle]].obj;
+    }
+
+public: // push/pop
+    HandleType push(const T &obj) {
+        HandleType handle = _alloc_handle();
+        mHeap_d.push_back(Entry_ { obj, handle });
+        mPos_d[handle] = mHeap_d.size() - 1;
+        _adjust_up(mHeap_d.size() - 1);
+        return handle;
+    }
+
+    HandleType push(T &&obj) {
+        HandleType handle = _alloc_handle();
+        mHeap_d.push_back(Entry_ { dstruct::move(obj), handle });
+        mPos_d[handle] = mHeap_d.size() - 1;
+        _adjust_up(mHeap_d.size() - 1);
+        return handle;
+    }
+
+    void pop() {
+        DSTRUCT_ASSERT(!empty());
+        erase(mHeap_d[0].handle);
+    }
+
+public: // by handle - O(log n)
+    // replace obj, e.g. decrease-key / increase-key
+    void update(HandleType handle, const T &obj) {
+        DSTRUCT_ASSERT(contains(handle));
+        int index = mPos_d[handle];
+        mHeap_d[index].obj = obj;
+        if (_adjust_up(index) == index) {
+            _adjust_down(index);
+        }
+    }
+
+    void erase(HandleType handle) {
+        DSTRUCT_ASSERT(contains(handle));
+        int index = mPos_d[handle];
+        int last = mHeap_d.size() - 1;
+
+        if (index != last) {
+            mHeap_d[index] = dstruct::move(mHeap_d[last]);
+            mPos_d[mHeap_d[index].handle] = index;
+            mHeap_d.pop_back();
+            if (_adjust_up(index) == index) {
+                _adjust_down(index);
+            }
+        } else {
+            mHeap_d.pop_back();
+        }
+
+        mPos_d[handle] = -1;
+        mFreeHandles_d.push_back(handle);
+    }
+
+    void clear() {
+        mHeap_d.clear();
+        mPos_d.clear();
+        mFreeHandles_d.clear();
+    }
+
+protected:
+    Compare mCmp_d;
+    dstruct::Vector<Entry_, Alloc> mHeap_d;
+    dstruct::Vector<int, Alloc> mPos_d;
+    dstruct::Vector<int, Alloc> mFreeHandles_d;
+
+    HandleType _alloc_handle() {
+        if (!mFreeHandles_d.empty()) {
+            HandleType handle = mFreeHandles_d.back();
+            mFreeHandles_d.pop_back();
+            return handle;
+        }
+        mPos_d.push_back(-1);
+        return mPos_d.size() - 1;
+    }
+
+    // return the final index
+    int _adjust_up(int hole) {
+        Entry_ *heap = &mHeap_d[0];
+        int *pos = &mPos_d[0];
+
+        Entry_ entry = dstruct::move(heap[hole]);
+        while (hole > 0) {
+            int parent = (hole - 1) / 2;
+            if (mCmp_d(heap[parent].obj, entry.obj)) break;
+            heap[hole] = dstruct::move(heap[parent]);
+            pos[heap[hole].handle] = hole;
+            hole = parent;
+        }
+        pos[entry.handle] = hole;
+        heap[hole] = dstruct::move(entry);
+
+        return hole;
+    }
+
+    void _adjust_down(int hole) {
+        int heapSize = mHeap_d.size();
+        Entry_ *heap = &mHeap_d[0];
+        int *pos = &mPos_d[0];
+
+        Entry_ entry = dstruct::move(heap[hole]);
+        int child = 2 * hole + 1;
+        while (child < heapSize) {
+            if (child + 1 < heapSize && !mCmp_d(heap[child].obj, heap[child + 1].obj)) {
+                child++;
+            }
+
+            if (mCmp_d(entry.obj, heap[child].obj)) break;
+
+            heap[hole] = dstruct::move(heap[child]);
+            pos[heap[hole].handle] = hole;
+            hole = child;
+            child = 2 * hole + 1;
+        }
+        pos[entry.handle] = hole;
+        heap[hole] = dstruct::move(entry);
+    }
+};
+
+}
+
+#endif
@@ -15,6 +15,8 @@
 
 namespace dstruct {
 
+struct KeyValueInPlace { };
+
 template <typename KeyType, typename ValueType>
 struct KeyValue {
     KeyType key;
@@ -24,6 +26,18 @@ struct KeyValue {
 
     KeyValue(const KeyType &_key, const ValueType &_value) :
         key { _key }, value { _value } { }
+
+    // construct value by args in place, e.g. Map::try_emplace
+    template <typename... Args>
+    KeyValue(KeyValueInPlace, const KeyType &_key, Args&&... args) :
+        key { _key }, value(dstruct::forward<Args>(args)...) { }
+};
+
+// result of Map::try_emplace/insert_or_assign/find_or_insert
+template <typename Iterator>
+struct MapInsertResult {
+    Iterator it;
+    bool inserted;
 };
 
 // KeyValue
@@ -35,10 +49,76 @@ struct KVCMPKey {
         return mCMP_d_d(a.key, b.key);
     }
 
+    // compare with key directly, lookup without a KeyValue
+    template <typename K>
+    bool operator()(const K &key, const KVType &kv) const {
+        return mCMP_d_d(key, kv.key);
+    }
+
+    template <typename K>
+    bool operator()(const KVType &kv, const K &key) const {
+        return mCMP_d_d(kv.key, key);
+    }
+
 private:
     CMP mCMP_d_d;
 };
 
+// KeyValue, for HashTable backend
+template <typename KVType, typename Hash>
+struct KVHashKey {
+    KVHashKey(Hash hash = Hash()) : mHash_d_d { hash } { }
+
+    unsigned long long operator()(const KVType &kv) const {
+        return mHash_d_d(kv.key);
+    }
+
+    template <typename K>
+    unsigned long long operator()(const K &key) const {
+        return mHash_d_d(key);
+    }
+
+private:
+    Hash mHash_d_d;
+};
+
+template <typename KVType, typename Equal>
+struct KVEqualKey {
+    KVEqualKey(Equal equal = Equal()) : mEqual_d_d { equal } { }
+
+    bool operator()(const KVType &a, const KVType &b) const {
+        return mEqual_d_d(a.key, b.key);
+    }
+
+    template <typename K>
+    bool operator()(const KVType &kv, const K &key) const {
+        return mEqual_d_d(kv.key, key);
+    }
+
+private:
+    Equal mEqual_d_d;
+};
+
+// KeyValue, for BTree backend - inner nodes hold copies of key only
+template <typename KVType>
+struct KVGetKey;
+
+template <typename KType, typename VType>
+struct KVGetKey<KeyValue<const KType, VType>> {
+    using KeyType = KType;
+
+    const KeyType & operator()(const KeyValue<const KType, VType> &kv) const {
+        return kv.key;
+    }
+};
+
+/*
+DStruct: the backend container of KeyValue<const KType, VType>
+    AVLTree(default): ordered, O(log n)
+    HashTable: unordered, O(1) average - see dstruct::HashMap
+    BTree: ordered, O(log n) with a few cache misses per lookup - see dstruct::BTreeMap
+    RBTree: ordered, O(1) amortized rotations per push/pop - see dstruct::RBTreeMap
+*/
 template <
     typename KType, typename VType,
     typename KeyCMP = dstruct::less<KType>,
@@ -62,9 +142,12 @@ public:
     using KeyValueType         = typename DStruct::ValueType;
     using IteratorType         = typename DStruct::IteratorType;
     using ConstIteratorType    = typename DStruct::ConstIteratorType;
+    using AllocType            = typename DStruct::AllocType;
+    using InsertResultType     = MapInsertResult<IteratorType>;
 
 public: // big five
     Map() = default;
+    explicit Map(AllocType &alloc) : mDStruct_d(alloc) { }
     Map(const Map &) = default;
     Map & operator=(const Map &) = default;
     Map(Map &&) = default;
@@ -91,7 +174,7 @@ public: // Access & Modifiers
     }
 
     void pop(const KeyType &key) {
-        mDStruct_d.pop({key, ValueType()});
+        mDStruct_d._pop_by_key(key);
     }
 
     ConstReferenceType operator[](const KType &key) const {
@@ -101,21 +184,45 @@ public: // Access & Modifiers
     }
 
     ReferenceType operator[](const KType &key) {
-        auto target = find(key);
-        if (target == end()) {
-            // TODO: optimize to only once find(by find_and_insert)
-            mDStruct_d.push({key, ValueType()});
-            return dstruct::_remove_const(find(key)->value);
-        }
         // convert from const ValueType to ValueType - remove const
         // target: dstruct::A_VLTreeIterator_<dstruct::KeyValue<const char, int> >
         // Note: value original define haven't const, so this is not UB
-        return dstruct::_remove_const(find(key)->value);
+        return dstruct::_remove_const(find_or_insert(key).it->value);
+    }
+
+    // only once lookup: value is default-constructed if key not exist
+    InsertResultType find_or_insert(const KeyType &key) {
+        return try_emplace(key);
+    }
+
+    // construct value by args if key not exist, otherwise args are untouched
+    template <typename... Args>
+    InsertResultType try_emplace(const KeyType &key, Args&&... args) {
+        bool inserted = false;
+        auto it = mDStruct_d._find_or_insert(key, [&](KeyValueType *addr) {
+            dstruct::construct(addr, KeyValueInPlace(), key, dstruct::forward<Args>(args)...);
+        }, inserted);
+        return { it, inserted };
+    }
+
+    // value is assigned if key exist
+    template <typename V>
+    InsertResultType insert_or_assign(const KeyType &key, V &&value) {
+        bool inserted = false;
+        auto it = mDStruct_d._find_or_insert(key, [&](KeyValueType *addr) {
+            dstruct::construct(addr, KeyValueInPlace(), key, dstruct::forward<V>(value));
+        }, inserted);
+        if (!inserted) dstruct::_remove_const(it->value) = dstruct::forward<V>(value);
+        return { it, inserted };
     }
 
 public:
     IteratorType find(const KeyType &key) {
-        return mDStruct_d.find(KeyValueType { key, ValueType() });
+        return mDStruct_d._find_by_key(key);
+    }
+
+    ConstIteratorType find(const KeyType &key) const {
+        return mDStruct_d._find_by_key(key);
     }
 
     IteratorType erase(IteratorType &it) {
@@ -0,0 +1,230 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef PAIRING_HEAP_HPP_DSTRUCT
+#define PAIRING_HEAP_HPP_DSTRUCT
+
+#include <core/common.hpp>
+#include <core/ds/array/Vector.hpp>
+
+namespace dstruct {
+
+/*
+PairingHeap: node-based heap, O(1) push/meld, amortized O(log n) pop
+
+    root
+     |child
+     V      sibling      sibling
+    node ----------> node ----------> node
+     |child           |child
+     V                V
+    ...              ...
+
+    link(a, b):  the "smaller" one become parent, the other is pushed to its child list - O(1)
+    push:        link(root, new node)
+    meld:        link(root, other.root), other is empty after it
+    pop:         two-pass pairing of root's children
+                 1. left -> right: link pairs
+                 2. right -> left: link the results into one tree
+
+Note: node size is fixed(PairingHeapNode_<T>), use PoolAlloc for fast node alloc,
+      see dstruct::pmemory::PairingHeap
+*/
+
+template <typename T>
+struct PairingHeapNode_ {
+    T data;
+    PairingHeapNode_ *child;
+    PairingHeapNode_ *sibling;
+};
+
+// Compare(parent, child) == true
+template <typename T, typename Compare, typename Alloc = dstruct::Alloc>
+class PairingHeap : public DStructTypeSpec<T, Alloc, void, void> {
+
+protected:
+    using Node_ = PairingHeapNode_<T>;
+    using AllocNode_ = AllocSpec<Node_, Alloc>;
+
+public: // big five
+    PairingHeap(const Compare &cmp = Compare()) :
+        mCmp_d { cmp }, mRootPtr_d { nullptr }, mSize_d { 0 } { }
+
+    explicit PairingHeap(Alloc &alloc, const Compare &cmp = Compare()) : PairingHeap::DStructTypeSpec { alloc },
+        mCmp_d { cmp }, mRootPtr_d { nullptr }, mSize_d { 0 } { }
+
+    DSTRUCT_COPY_SEMANTICS(PairingHeap) {
+        clear();
+        PairingHeap::Alloc_::_alloc_inherit(ds);
+        mCmp_d = ds.mCmp_d;
+
+        // walk child/sibling links with a stack, shape isn't kept
+        dstruct::Vector<Node_ *> stack;
+        if (ds.mRootPtr_d) stack.push_back(ds.mRootPtr_d);
+        while (!stack.empty()) {
+            Node_ *node = stack.back();
+            stack.pop_back();
+            push(node->data);
+            if (node->sibling) stack.push_back(node->sibling);
+            if (node->child) stack.push_back(node->child);
+        }
+
+        return *this;
+    }
+
+    DSTRUCT_MOVE_SEMANTICS(PairingHeap) {
+        clear();
+        PairingHeap::Alloc_::_alloc_take(ds);
+
+        mCmp_d = ds.mCmp_d;
+        mRootPtr_d = ds.mRootPtr_d;
+        mSize_d = ds.mSize_d;
+
+        ds.mRootPtr_d = nullptr;
+        ds.mSize_d = 0;
+
+        return *this;
+    }
+
+    ~PairingHeap() {
+        clear();
+    }
+
+public: // status
+    typename PairingHeap::SizeType size() const {
+        return mSize_d;
+    }
+
+    bool empty() const {
+        return mSize_d == 0;
+    }
+
+public: // check
+    typename PairingHeap::ConstReferenceType top() const {
+        DSTRUCT_ASSERT(mRootPtr_d != nullptr);
+        return mRootPtr_d->data;
+    }
+
+public: // push/pop
+    void push(const T &obj) {
+        _push_node(_create_node(obj));
+    }
+
+    void push(T &&obj) {
+        _push_node(_create_node(dstruct::move(obj)));
+    }
+
+    void pop() {
+        DSTRUCT_ASSERT(mRootPtr_d != nullptr);
+        Node_ *oldRoot = mRootPtr_d;
+        mRootPtr_d = _merge_pairs(oldRoot->child);
+        _destroy_node(oldRoot);
+        mSize_d--;
+    }
+
+    // move all objs of heap to this - O(1), heap is empty after meld
+    // request: nodes are allocated from the same alloc(-instance)
+    void meld(PairingHeap &heap) {
+        if (this == &heap || heap.mRootPtr_d == nullptr) return;
+        DSTRUCT_ASSERT(PairingHeap::Alloc_::_alloc_instance() == heap.PairingHeap::Alloc_::_alloc_instance());
+
+        mRootPtr_d = mRootPtr_d ? _link(mRootPtr_d, heap.mRootPtr_d) : heap.mRootPtr_d;
+        mSize_d += heap.mSize_d;
+
+        heap.mRootPtr_d = nullptr;
+        heap.mSize_d = 0;
+    }
+
+    void clear() {
+        // child/sibling as left/right of a binary tree, rotate right to free without stack
+        Node_ *node = mRootPtr_d;
+        while (node != nullptr) {
+            if (node->child != nullptr) {
+                Node_ *child = node->child;
+                node->child = child->sibling;
+                child->sibling = node;
+                node = child;
+            } else {
+                Node_ *next = node->sibling;
+                _destroy_node(node);
+                node = next;
+            }
+        }
+        mRootPtr_d = nullptr;
+        mSize_d = 0;
+    }
+
+protected:
+    Compare mCmp_d;
+    Node_ *mRootPtr_d;
+    typename PairingHeap::SizeType mSize_d;
+
+    template <typename U>
+    Node_ * _create_node(U &&obj) {
+        Node_ *node = AllocNode_(*this).allocate();
+        DSTRUCT_ASSERT(node != nullptr);
+        dstruct::construct(&(node->data), dstruct::forward<U>(obj));
+        node->child = node->sibling = nullptr;
+        return node;
+    }
+
+    void _destroy_node(Node_ *node) {
+        dstruct::destroy(&(node->data));
+        AllocNode_(*this).deallocate(node);
+    }
+
+    void _push_node(Node_ *node) {
+        mRootPtr_d = mRootPtr_d ? _link(mRootPtr_d, node) : node;
+        mSize_d++;
+    }
+
+    // a and b are roots(sibling is ignored), return the new root
+    Node_ * _link(Node_ *a, Node_ *b) {
+        if (!mCmp_d(a->data, b->data)) {
+            Node_ *tmp = a; a = b; b = tmp;
+        }
+        b->sibling = a->child;
+        a->child = b;
+        a->sibling = nullptr;
+        return a;
+    }
+
+    Node_ * _merge_pairs(Node_ *first) {
+        // pass 1: link pairs, results are kept in a reversed list
+        Node_ *paired = nullptr;
+        while (first != nullptr) {
+            Node_ *a = first;
+            Node_ *b = first->sibling;
+            if (b == nullptr) {
+                a->sibling = paired;
+                paired = a;
+                break;
+            }
+            first = b->sibling;
+            Node_ *tree = _link(a, b);
+            tree->sibling = paired;
+            paired = tree;
+        }
+
+        // pass 2: link from the last pair to the first
+        Node_ *root = nullptr;
+        while (paired != nullptr) {
+            Node_ *next = paired->sibling;
+            root = root ? _link(root, paired) : paired;
+            root->sibling = nullptr;
+            paired = next;
+        }
+
+        return root;
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,191 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef RADIX_HEAP_HPP_DSTRUCT
+#define RADIX_HEAP_HPP_DSTRUCT
+
+#include <core/common.hpp>
+#include <core/ds/array/Vector.hpp>
+
+namespace dstruct {
+
+/*
+RadixHeap: min-heap for monotone unsigned keys, e.g. event timestamp / Dijkstra distance
+
+    mLast_d: the last popped key, every pushed key >= mLast_d(monotone)
+
+    bucket:  0          1          2              i                  BITS
+           +-------+  +-------+  +-------+      +----------------+
+           | ==last|  | bit 0 |  | bit 1 | ...  | highest diff   |  ...
+           +-------+  +-------+  +-------+      | bit is i - 1   |
+                                                +----------------+
+    bucket index of key: bit width of (key ^ mLast_d), 0 when key == mLast_d
+
+    push: O(1), append to its bucket
+    pop:  bucket 0 is empty -> find the first non-empty bucket i, mLast_d = min key of it,
+          redistribute it to buckets < i - every obj moves down at most BITS times
+
+Note:
+    obj with same key are popped in any order
+    top() fix the current min as mLast_d, don't push a smaller key after it(e.g. Dijkstra is fine)
+usage:
+    dstruct::RadixHeap<unsigned int> heap;
+    dstruct::RadixHeap<Event, EventTime> heap; // EventTime: KeyType + KeyType operator()(const Event &)
+*/
+
+template <typename T>
+struct RadixHeapKey {
+    using KeyType = T;
+
+    KeyType operator()(const T &obj) const {
+        return obj;
+    }
+};
+
+template <typename T, typename GetKey = RadixHeapKey<T>, typename Alloc = dstruct::Alloc>
+class RadixHeap {
+
+    using Key_ = typename GetKey::KeyType;
+    using Bucket_ = dstruct::Vector<T, Alloc, vector::NoShrinkPolicy>; // keep capacity for redistribute
+
+    static_assert(static_cast<Key_>(-1) > 0, "KeyType isn't unsigned");
+    static_assert(sizeof(Key_) <= 8, "KeyType is wider than 64 bits");
+
+    constexpr static int KEY_BITS = sizeof(Key_) * 8;
+
+public:
+    using ValueType            = T;
+    using ConstReferenceType   = const ValueType &;
+    using SizeType             = size_t;
+    using KeyType              = Key_;
+
+public: // big five
+    RadixHeap(const GetKey &getKey = GetKey()) : mGetKey_d { getKey }, mLast_d { 0 }, mSize_d { 0 } { }
+
+    explicit RadixHeap(Alloc &alloc, const GetKey &getKey = GetKey()) : RadixHeap(getKey) {
+        for (int i = 0; i <= KEY_BITS; i++) {
+            mBuckets_d[i] = Bucket_(alloc);
+        }
+    }
+
+    RadixHeap(const RadixHeap &) = default;
+    RadixHeap & operator=(const RadixHeap &) = default;
+
+    RadixHeap(RadixHeap &&heap) : RadixHeap() { *this = dstruct::move(heap); }
+    RadixHeap & operator=(RadixHeap &&heap) {
+        if (this == &heap) return *this;
+        for (int i = 0; i <= KEY_BITS; i++) {
+            mBuckets_d[i] = dstruct::move(heap.mBuckets_d[i]);
+        }
+        mGetKey_d = heap.mGetKey_d;
+        mLast_d = heap.mLast_d;
+        mSize_d = heap.mSize_d;
+        heap.mLast_d = 0;
+        heap.mSize_d = 0;
+        return *this;
+    }
+
+    ~RadixHeap() = default;
+
+public: // status
+    SizeType size() const {
+        return mSize_d;
+    }
+
+    bool empty() const {
+        return mSize_d == 0;
+    }
+
+    // the last popped key, lower bound of next push
+    KeyType last_key() const {
+        return mLast_d;
+    }
+
+public: // check
+    ConstReferenceType top() const {
+        DSTRUCT_ASSERT(mSize_d > 0);
+        _refill();
+        return mBuckets_d[0].back();
+    }
+
+public: // push/pop
+    void push(const T &obj) {
+        mBuckets_d[_bucket_index(mGetKey_d(obj))].push_back(obj);
+        mSize_d++;
+    }
+
+    void push(T &&obj) {
+        int index = _bucket_index(mGetKey_d(obj));
+        mBuckets_d[index].push_back(dstruct::move(obj));
+        mSize_d++;
+    }
+
+    void pop() {
+        DSTRUCT_ASSERT(mSize_d > 0);
+        _refill();
+        mBuckets_d[0].pop_back();
+        mSize_d--;
+    }
+
+    void clear() {
+        for (int i = 0; i <= KEY_BITS; i++) {
+            mBuckets_d[i].clear();
+        }
+        mLast_d = 0;
+        mSize_d = 0;
+    }
+
+protected:
+    GetKey mGetKey_d;
+    // top() is const, but may refill bucket 0 lazily - the popped order is unchanged
+    mutable KeyType mLast_d;
+    mutable Bucket_ mBuckets_d[KEY_BITS + 1];
+    SizeType mSize_d;
+
+    static int _bit_width(KeyType x) {
+#if defined(__GNUC__) || defined(__clang__)
+        return x == 0 ? 0 : 64 - __builtin_clzll(static_cast<unsigned long long>(x));
+#else
+        int width = 0;
+        while (x != 0) { x >>= 1; width++; }
+        return width;
+#endif
+    }
+
+    int _bucket_index(KeyType key) const {
+        DSTRUCT_ASSERT(key >= mLast_d); // monotone
+        return _bit_width(key ^ mLast_d);
+    }
+
+    void _refill() const {
+        if (!mBuckets_d[0].empty()) return;
+
+        int i = 1;
+        while (mBuckets_d[i].empty()) i++;
+
+        Bucket_ &bucket = mBuckets_d[i];
+        KeyType minKey = mGetKey_d(bucket[0]);
+        for (auto it = bucket.begin(); it != bucket.end(); it++) {
+            KeyType key = mGetKey_d(*it);
+            if (key < minKey) minKey = key;
+        }
+
+        // all keys in bucket i share the bits above i - 1 with minKey, move to buckets < i
+        mLast_d = minKey;
+        while (!bucket.empty()) {
+            T &obj = bucket[bucket.size() - 1];
+            mBuckets_d[_bucket_index(mGetKey_d(obj))].push_back(dstruct::move(obj));
+            bucket.pop_back();
+        }
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,174 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef SMALL_VECTOR_HPP_DSTRUCT
+#define SMALL_VECTOR_HPP_DSTRUCT
+
+#include <core/common.hpp>
+#include <core/ds/array/Vector.hpp>
+
+namespace dstruct {
+
+/*
+SmallVector: Vector with inline buffer for N elements, only spill to Alloc past N
+
+    +--------------------+----------------------------+
+    | Vector(mC_d, ...)  | inline buffer(N elements)  |
+    +--------------------+----------------------------+
+        |                  ^
+        +------------------+  size <= N: mC_d point to inline buffer
+        +-----> heap          size >  N: mC_d point to Alloc's memory
+
+impl: Vector + instance alloc(SmallBufferAlloc_) owning the inline buffer,
+      the capacity policy keep capacity >= N, so inline buffer is used first
+*/
+
+template <typename T, size_t N, typename Alloc>
+struct SmallBufferAlloc_ {
+    using InstanceAllocTag = void;
+
+    SmallBufferAlloc_() : mInUse_d { false } { }
+
+    void * allocate(int bytes) {
+        if (!mInUse_d && bytes <= static_cast<int>(sizeof(mBuffer_d))) {
+            mInUse_d = true;
+            return mBuffer_d;
+        }
+        return Alloc::allocate(bytes);
+    }
+
+// GCC may lose the addr != mBuffer_d check once Alloc::deallocate is inlined,
+// and report a false -Wfree-nonheap-object on the inline buffer
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfree-nonheap-object"
+#endif
+    void deallocate(void *addr, int bytes) {
+        if (addr == mBuffer_d) {
+            mInUse_d = false;
+        } else {
+            Alloc::deallocate(addr, bytes);
+        }
+    }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+    bool _is_inline(const void *addr) const {
+        return addr == mBuffer_d;
+    }
+
+protected:
+    bool mInUse_d;
+    alignas(T) char mBuffer_d[N * sizeof(T)];
+};
+
+template <size_t N, typename Policy>
+struct SmallVectorPolicy_ {
+    static size_t grow(size_t capacity, size_t required) {
+        size_t newCapacity = Policy::grow(capacity, required);
+        return newCapacity < N ? N : newCapacity;
+    }
+
+    static size_t shrink(size_t size, size_t capacity) {
+        if (capacity <= N) return capacity;
+        size_t newCapacity = Policy::shrink(size, capacity);
+        return newCapacity < N ? N : newCapacity;
+    }
+};
+
+// base-from-member: construct buffer before Vector
+template <typename T, size_t N, typename Alloc>
+struct SmallBufferHolder_ {
+    SmallBufferAlloc_<T, N, Alloc> mBufferAlloc_d;
+};
+
+template <typename T, size_t N, typename Alloc = dstruct::Alloc, typename Policy = vector::DefaultPolicy>
+class SmallVector :
+    protected SmallBufferHolder_<T, N, Alloc>,
+    public Vector<T, SmallBufferAlloc_<T, N, Alloc>, SmallVectorPolicy_<N, Policy>> {
+
+    static_assert(N > 0, "N == 0, pls use Vector");
+
+    using Holder_ = SmallBufferHolder_<T, N, Alloc>;
+    using Vector_ = Vector<T, SmallBufferAlloc_<T, N, Alloc>, SmallVectorPolicy_<N, Policy>>;
+
+    DSTRUCT_TYPE_SPEC_HELPER(Vector_)
+
+public: // big five
+    SmallVector() : Holder_(), Vector_(Holder_::mBufferAlloc_d) {
+        Vector_::reserve(N);
+    }
+
+    SmallVector(size_t n, ConstReferenceType element) : SmallVector() {
+        resize(n, element);
+    }
+
+    DSTRUCT_COPY_SEMANTICS(SmallVector) {
+        Vector_::clear();
+        Vector_::reserve(ds.mSize_d > N ? ds.mSize_d : N);
+        for (SizeType i = 0; i < ds.mSize_d; i++) {
+            dstruct::construct(this->mC_d + i, ds.mC_d[i]);
+        }
+        this->mSize_d = ds.mSize_d;
+        return *this;
+    }
+
+    DSTRUCT_MOVE_SEMANTICS(SmallVector) {
+        Vector_::clear();
+        if (ds.is_inline()) { // can't take over ds's inline buffer, move elements
+            Vector_::reserve(N);
+            Vector_::_relocate(this->mC_d, ds.mC_d, ds.mSize_d);
+            this->mSize_d = ds.mSize_d;
+            ds.mSize_d = 0;
+        } else {
+            this->mC_d = ds.mC_d;
+            this->mSize_d = ds.mSize_d;
+            this->mCapacity_d = ds.mCapacity_d;
+            ds.mC_d = nullptr;
+            ds.mSize_d = ds.mCapacity_d = 0;
+        }
+        return *this;
+    }
+
+    ~SmallVector() = default;
+
+public:
+    bool is_inline() const {
+        return Holder_::mBufferAlloc_d._is_inline(this->mC_d);
+    }
+
+    // Note: set capacity to max(n, N), size is truncated when n < size
+    void resize(size_t n) {
+        while (this->mSize_d > n) {
+            dstruct::destroy(this->mC_d + --(this->mSize_d));
+        }
+        size_t capacity = n > N ? n : N;
+        if (capacity != this->mCapacity_d) {
+            Vector_::resize(capacity);
+        }
+    }
+
+    void resize(size_t n, ConstReferenceType element) {
+        ValueType value(element); // element may refer to self
+        resize(n);
+        for (size_t i = this->mSize_d; i < n; i++) {
+            dstruct::construct(this->mC_d + i, value);
+        }
+        this->mSize_d = n;
+    }
+
+    void shrink_to_fit() {
+        resize(this->mSize_d);
+    }
+};
+
+}
+
+#endif
@@ -14,7 +14,45 @@
 
 namespace dstruct {
 
-template <typename T, typename Alloc = dstruct::Alloc>
+namespace vector {
+/*
+// Policy: capacity strategy of Vector
+struct Policy {
+    // new capacity(>= required) when required > capacity
+    static size_t grow(size_t capacity, size_t required);
+    // new capacity(>= size) after pop, return capacity to keep it
+    static size_t shrink(size_t size, size_t capacity);
+};
+*/
+
+// grow:   capacity * GROW_NUM / GROW_DEN
+// shrink: to half when size < capacity / SHRINK_DIV, SHRINK_DIV == 0 is no auto-shrink
+// Note: SHRINK_DIV > 2 keep a gap(hysteresis) between shrink and the next grow
+template <int GROW_NUM, int GROW_DEN, int SHRINK_DIV>
+struct GeometricPolicy {
+    static_assert(GROW_NUM > GROW_DEN && GROW_DEN > 0, "growth factor <= 1");
+    static_assert(SHRINK_DIV == 0 || SHRINK_DIV > 2, "SHRINK_DIV <= 2, push/pop will thrash");
+
+    static size_t grow(size_t capacity, size_t required) {
+        size_t newCapacity = capacity * GROW_NUM / GROW_DEN;
+        if (newCapacity < 2) newCapacity = 2;
+        return newCapacity < required ? required : newCapacity;
+    }
+
+    static size_t shrink(size_t size, size_t capacity) {
+        if (SHRINK_DIV != 0 && size < capacity / SHRINK_DIV)
+            return capacity / 2;
+        return capacity;
+    }
+};
+
+using DefaultPolicy     = GeometricPolicy<2, 1, 4>;
+using Growth1_5xPolicy  = GeometricPolicy<3, 2, 4>;
+using NoShrinkPolicy    = GeometricPolicy<2, 1, 0>;
+
+} // namespace vector
+
+template <typename T, typename Alloc = dstruct::Alloc, typename Policy = vector::DefaultPolicy>
 class Vector : public DStructTypeSpec_<T, Alloc, PrimitiveIterator> {
 
     DSTRUCT_TYPE_SPEC_HELPER(Vector);
@@ -22,28 +60,38 @@ class Vector : public DStructTypeSpec_<T, Alloc, PrimitiveIterator> {
 public: // big five
     Vector() :  mSize_d { 0 }, mCapacity_d { 0 }, mC_d { nullptr } { }
 
+    explicit Vector(Alloc &alloc) : Vector::DStructTypeSpec { alloc },
+        mSize_d { 0 }, mCapacity_d { 0 }, mC_d { nullptr } { }
+
+    // share alloc-instance with other dstruct, e.g. DoubleEndedQueue's map-table
+    template <typename U>
+    explicit Vector(const AllocSpec<U, Alloc> &as) : Vector::DStructTypeSpec { as },
+        mSize_d { 0 }, mCapacity_d { 0 }, mC_d { nullptr } { }
+
     Vector(size_t n, ConstReferenceType element) : Vector() {
         DSTRUCT_ASSERT(n != 0);
-        resize(n);
-        for (int i = 0; i < n; i++)
-             dstruct::construct(mC_d + i, element);
-        mSize_d = n;
-        mCapacity_d = n;
+        resize(n, element);
+    }
+
+    Vector(size_t n, ConstReferenceType element, Alloc &alloc) : Vector(alloc) {
+        DSTRUCT_ASSERT(n != 0);
+        resize(n, element);
     }
 
     DSTRUCT_COPY_SEMANTICS(Vector) {
         clear();
-        resize(ds.mCapacity_d);
-        mSize_d = ds.mSize_d;
-        for (int i = 0; i < mSize_d; i++) {
-            dstruct::destroy(mC_d + i);
+        Vector::Alloc_::_alloc_inherit(ds);
+        resize(ds.mSize_d); // only alloc for data
+        for (SizeType i = 0; i < ds.mSize_d; i++) {
             dstruct::construct(mC_d + i, ds.mC_d[i]);
         }
+        mSize_d = ds.mSize_d;
         return *this;
     }
 
     DSTRUCT_MOVE_SEMANTICS(Vector) {
         clear();
+        Vector::Alloc_::_alloc_take(ds);
 
         this->mC_d = ds.mC_d;
         this->mSize_d = ds.mSize_d;
@@ -96,13 +144,27 @@ public: // Modifiers
     }
 
     void push_back(ConstReferenceType element) {
+        emplace_back(element);
+    }
+
+    void push_back(T &&element) {
+        emplace_back(dstruct::move(element));
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
         if (mSize_d + 1 > mCapacity_d) {
-            if (mSize_d)
-                resize(2 * mSize_d);
-            else
-                resize(2);
+            // construct new element before relocate, args may refer to old element
+            SizeType newCapacity = Policy::grow(mCapacity_d, mSize_d + 1);
+            PointerType newC = Vector::Alloc_::allocate(newCapacity);
+            dstruct::construct(newC + mSize_d, dstruct::forward<Args>(args)...);
+            _relocate(newC, mC_d, mSize_d);
+            if (mC_d) Vector::Alloc_::deallocate(mC_d, mCapacity_d);
+            mC_d = newC;
+            mCapacity_d = newCapacity;
+        } else {
+            dstruct::construct(mC_d + mSize_d, dstruct::forward<Args>(args)...);
         }
-        dstruct::construct(mC_d + mSize_d, element);
         mSize_d++;
     }
 
@@ -114,8 +176,10 @@ public: // Modifiers
         DSTRUCT_ASSERT(mSize_d > 0);
         --mSize_d;
         dstruct::destroy(mC_d + mSize_d);
-        if (mSize_d < mCapacity_d / 3) {
-            resize(mCapacity_d / 2);
+        SizeType newCapacity = Policy::shrink(mSize_d, mCapacity_d);
+        if (newCapacity < mCapacity_d) {
+            DSTRUCT_ASSERT(newCapacity >= mSize_d);
+            resize(newCapacity);
         }
     }
 
@@ -156,6 +220,17 @@ public: // iterator
     }
 
 public:
+    void reserve(size_t n) {
+        if (n > mCapacity_d)
+            resize(n);
+    }
+
+    void shrink_to_fit() {
+        if (mSize_d < mCapacity_d)
+            resize(mSize_d);
+    }
+
+    // Note: set capacity to n, size is truncated when n < size
     void resize(size_t n) {
         PointerType oldC = mC_d;
 
@@ -166,11 +241,10 @@ public:
 
         if (oldC) {
             DSTRUCT_ASSERT(mCapacity_d != 0);
-            for (int i = 0; i < mSize_d; i++) {
-                if (i < n) // TODO: use move by check type-tag
-                    dstruct::construct(mC_d + i, oldC[i]);
+            for (size_t i = n; i < mSize_d; i++) {
                 dstruct::destroy(oldC + i);
             }
+            _relocate(mC_d, oldC, n < mSize_d ? n : mSize_d);
             Vector::Alloc_::deallocate(oldC, mCapacity_d);
         }
 
@@ -191,27 +265,166 @@ public:
         PointerType oldC = mC_d;
         mC_d = Vector::Alloc_::allocate(n);
 
+        // set, before release: element may refer to old element
+        for (size_t i = mSize_d; i < n; i++) {
+            dstruct::construct(mC_d + i, element);
+        }
+
         // release
         if (oldC) {
-            for (int i = 0; i < mSize_d; i++) {
-                if (i < n) // TODO: use move by check type-tag
-                    dstruct::construct(mC_d + i, oldC[i]);
+            for (size_t i = n; i < mSize_d; i++) {
                 dstruct::destroy(oldC + i);
             }
+            _relocate(mC_d, oldC, n < mSize_d ? n : mSize_d);
             Vector::Alloc_::deallocate(oldC, mCapacity_d);
         }
 
-        // set
-        for (int i = mSize_d; i < n; i++) {
-            dstruct::construct(mC_d + i, element);
+        mCapacity_d = mSize_d = n;
+    }
+
+public: // bulk op - at most one reallocation
+    template <typename Iterator>
+    void append(Iterator first, Iterator last) {
+        insert(end(), first, last);
+    }
+
+    // Note: [first, last) may be a range of self
+    template <typename Iterator>
+    IteratorType insert(IteratorType pos, Iterator first, Iterator last) {
+        SizeType index = pos - begin();
+        DSTRUCT_ASSERT(index <= mSize_d);
+
+        SizeType n = _range_size(first, last);
+        if (n == 0) return mC_d + index;
+
+        if (mSize_d + n > mCapacity_d || (index < mSize_d && _is_self_element(&(*first)))) {
+            SizeType newCapacity = mCapacity_d;
+            if (mSize_d + n > mCapacity_d)
+                newCapacity = Policy::grow(mCapacity_d, mSize_d + n);
+            PointerType newC = Vector::Alloc_::allocate(newCapacity);
+            // construct new elements before relocate, range may refer to old element
+            _construct_range(newC + index, first, n);
+            if (mC_d) {
+                _relocate(newC, mC_d, index);
+                _relocate(newC + index + n, mC_d + index, mSize_d - index);
+                Vector::Alloc_::deallocate(mC_d, mCapacity_d);
+            }
+            mC_d = newC;
+            mCapacity_d = newCapacity;
+        } else {
+            _relocate_overlap(mC_d + index + n, mC_d + index, mSize_d - index);
+            _construct_range(mC_d + index, first, n);
         }
 
-        mCapacity_d = mSize_d = n;
+        mSize_d += n;
+
+        return mC_d + index;
+    }
+
+    IteratorType erase(IteratorType pos) {
+        return erase(pos, pos + 1);
+    }
+
+    IteratorType erase(IteratorType first, IteratorType last) {
+        SizeType index = first - begin();
+        SizeType n = last - first;
+        DSTRUCT_ASSERT(index + n <= mSize_d);
+
+        if (n == 0) return mC_d + index;
+
+        for (SizeType i = index; i < index + n; i++) {
+            dstruct::destroy(mC_d + i);
+        }
+        _relocate_overlap(mC_d + index, mC_d + index + n, mSize_d - index - n);
+        mSize_d -= n;
+
+        SizeType newCapacity = Policy::shrink(mSize_d, mCapacity_d);
+        if (newCapacity < mCapacity_d) {
+            DSTRUCT_ASSERT(newCapacity >= mSize_d);
+            resize(newCapacity);
+        }
+
+        return mC_d + index;
+    }
+
+    // Note: replace all elements by n copies of element, keep capacity if it's enough
+    void assign(size_t n, ConstReferenceType element) {
+        if (n > mCapacity_d) {
+            PointerType newC = Vector::Alloc_::allocate(n);
+            for (size_t i = 0; i < n; i++) {
+                dstruct::construct(newC + i, element);
+            }
+            clear(); // after construct: element may refer to old element
+            mC_d = newC;
+            mCapacity_d = n;
+        } else {
+            size_t assignSize = n < mSize_d ? n : mSize_d;
+            for (size_t i = 0; i < assignSize; i++) {
+                mC_d[i] = element;
+            }
+            for (size_t i = mSize_d; i < n; i++) {
+                dstruct::construct(mC_d + i, element);
+            }
+            for (size_t i = n; i < mSize_d; i++) {
+                dstruct::destroy(mC_d + i);
+            }
+        }
+        mSize_d = n;
     }
 
 protected: // data member
     SizeType mSize_d, mCapacity_d;
     PointerType mC_d;
+
+    template <typename Iterator>
+    static SizeType _range_size(Iterator first, const Iterator &last) {
+        SizeType n = 0;
+        for (; first != last; ++first) n++;
+        return n;
+    }
+
+    template <typename Iterator>
+    static void _construct_range(PointerType dst, Iterator first, SizeType n) {
+        for (SizeType i = 0; i < n; i++, ++first) {
+            dstruct::construct(dst + i, *first);
+        }
+    }
+
+    bool _is_self_element(const void *addr) const {
+        return addr >= static_cast<const void *>(mC_d) && addr < static_cast<const void *>(mC_d + mSize_d);
+    }
+
+    // like _relocate, but [dst, dst + n) may overlap [src, src + n)
+    static void _relocate_overlap(PointerType dst, PointerType src, SizeType n) {
+        if (IsTriviallyRelocatable<T>::value) {
+            if (n) dstruct::mem_move(dst, src, n * sizeof(T));
+        } else if (dst < src) {
+            _relocate(dst, src, n); // forward
+        } else {
+            for (SizeType i = n; i > 0; i--) {
+                dstruct::construct(dst + i - 1, dstruct::move(src[i - 1]));
+                dstruct::destroy(src + i - 1);
+            }
+        }
+    }
+
+    // move [src, src + n) to uninitialized dst, and destroy src
+    static void _relocate(PointerType dst, PointerType src, SizeType n) {
+        if (IsTriviallyRelocatable<T>::value) {
+            if (n) dstruct::mem_copy(dst, src, n * sizeof(T));
+        } else {
+            for (SizeType i = 0; i < n; i++) {
+                dstruct::construct(dst + i, dstruct::move(src[i]));
+                dstruct::destroy(src + i);
+            }
+        }
+    }
+};
+
+// no self-reference, relocate by memcpy
+template <typename T, typename Alloc, typename Policy>
+struct IsTriviallyRelocatable<Vector<T, Alloc, Policy>> {
+    const static bool value = true;
 };
 
 };
@@ -0,0 +1,533 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef HASH_TABLE_HPP_DSTRUCT
+#define HASH_TABLE_HPP_DSTRUCT
+
+#include <core/common.hpp>
+#include <core/ds/string/BasicString.hpp>
+
+#ifdef DSTRUCT_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace dstruct {
+
+// FNV-1a
+inline unsigned long long hash_bytes(const void *data, unsigned long long bytes) {
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    unsigned long long h = 14695981039346656037ULL;
+    while (bytes--) {
+        h ^= *p++;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// integral/enum types, the table mixes the bits - identity is fine
+template <typename T>
+struct hash {
+    unsigned long long operator()(const T &obj) const {
+        return static_cast<unsigned long long>(obj);
+    }
+};
+
+template <typename T>
+struct hash<T *> {
+    unsigned long long operator()(const T *ptr) const {
+        return reinterpret_cast<unsigned long long>(ptr);
+    }
+};
+
+template <typename CharType, typename Alloc>
+struct hash<BasicString<CharType, Alloc>> {
+    unsigned long long operator()(const BasicString<CharType, Alloc> &str) const {
+        return hash_bytes(str.c_str(), str.size() * sizeof(CharType));
+    }
+};
+
+template <typename T>
+class HashTableIterator_ : public DStructIteratorTypeSpec<const T> {
+private:
+    using Self = HashTableIterator_;
+public:
+    HashTableIterator_(const T *slot = nullptr, const unsigned char *ctrl = nullptr) : mCtrl_d { ctrl } {
+        Self::mPointer_d = slot;
+    }
+
+public: // ForwardIterator
+    Self& operator++() {
+        Self::mPointer_d++; mCtrl_d++;
+        _skip_empty();
+        return *this;
+    }
+
+    Self operator++(int) {
+        Self old = *this;
+        ++(*this);
+        return old;
+    }
+
+public:
+    // move to the first used slot, stop at the end sentinel
+    void _skip_empty() {
+        while (*mCtrl_d == 0) {
+            Self::mPointer_d++; mCtrl_d++;
+        }
+    }
+
+    const unsigned char * _get_ctrl_pointer() const {
+        return mCtrl_d;
+    }
+
+private:
+    const unsigned char *mCtrl_d;
+};
+
+/*
+HashTable: open addressing with Robin Hood hashing, no tombstone
+
+    home:  (hash * golden ratio) >> (64 - log2(capacity)), objs of a cluster are sorted by home
+    ctrl:  one byte per slot - 0: empty, d + 1: the obj is d slots after its home(probe distance)
+
+           home(a) = home(b) = 2, home(c) = 3
+           slot:  0   1   2   3   4   5   6  ... capacity ... capacity + tail | END      16 byte
+           ctrl: [0] [0] [1] [2] [2] [0] [0] ...              ...             | 0xFF   [0 ... 0]
+                          a   b   c
+
+    find:  walk from home with expected ctrl 1, 2, 3 ...
+           ctrl == expected -> same home, compare key
+           ctrl <  expected -> stop(empty, or a "richer" obj - the key can't be after it)
+           SSE2: check home slot, then a group of 16 ctrl per step - compare with expected
+                 [e, e + 1, ... e + 15] by cmpeq/cmplt + movemask, candidates are the match bits
+                 before the first stop bit
+    push:  walk as find to the insert pos, shift [pos, next empty) right by one slot(ctrl + 1)
+    pop:   backward shift - move the following objs(ctrl > 1) left by one slot(ctrl - 1), no tombstone
+
+    no wrap around: the tail(min(capacity, DIST_LIMIT) slots) holds clusters overflowed from the end,
+    grow when size > capacity * max_load_factor, a probe distance > DIST_LIMIT or the tail is full
+
+Note:
+    iterator is invalidated by push(may rehash), erase return the next iterator
+    T's key must not be modified by iterator(const)
+*/
+
+template <typename T, typename Hash = dstruct::hash<T>, typename Equal = dstruct::equal_to<T>, typename Alloc = dstruct::Alloc>
+class HashTable : public DStructTypeSpec<T, Alloc, HashTableIterator_<T>, HashTableIterator_<T>> {
+
+protected:
+    using Ctrl_ = unsigned char;
+    using AllocCtrl_ = AllocSpec<Ctrl_, Alloc>;
+    using AllocSlot_ = AllocSpec<T, Alloc>;
+
+    constexpr static int DIST_LIMIT = 100; // ctrl <= 101, keep 16 expected ctrl(simd group) < 128
+    constexpr static int GROUP_SIZE = 16;  // simd group, zero ctrl after the end sentinel for group load
+    constexpr static int MIN_CAPACITY = 8;
+    constexpr static Ctrl_ END_CTRL = 0xFF;
+
+public: // big five
+    HashTable(const Hash &hash = Hash(), const Equal &equal = Equal()) :
+        mHash_d { hash }, mEqual_d { equal },
+        mCtrl_d { nullptr }, mSlots_d { nullptr },
+        mCapacity_d { 0 }, mSlotNum_d { 0 }, mShift_d { 64 }, mSize_d { 0 }, mGrowAt_d { 0 },
+        mMaxLoadFactor_d { 0.875f } { }
+
+    explicit HashTable(Alloc &alloc, const Hash &hash = Hash(), const Equal &equal = Equal()) :
+        HashTable::DStructTypeSpec { alloc }, mHash_d { hash }, mEqual_d { equal },
+        mCtrl_d { nullptr }, mSlots_d { nullptr },
+        mCapacity_d { 0 }, mSlotNum_d { 0 }, mShift_d { 64 }, mSize_d { 0 }, mGrowAt_d { 0 },
+        mMaxLoadFactor_d { 0.875f } { }
+
+    DSTRUCT_COPY_SEMANTICS(HashTable) {
+        _destroy_table();
+        HashTable::Alloc_::_alloc_inherit(ds);
+
+        mHash_d = ds.mHash_d;
+        mEqual_d = ds.mEqual_d;
+        mMaxLoadFactor_d = ds.mMaxLoadFactor_d;
+
+        // same capacity and layout, copy slot by slot
+        if (ds.mCapacity_d) {
+            _create_table(ds.mCapacity_d);
+            dstruct::mem_copy(mCtrl_d, ds.mCtrl_d, mSlotNum_d);
+            for (SizeType_ i = 0; i < mSlotNum_d; i++) {
+                if (mCtrl_d[i]) dstruct::construct(mSlots_d + i, ds.mSlots_d[i]);
+            }
+            mSize_d = ds.mSize_d;
+        }
+
+        return *this;
+    }
+
+    DSTRUCT_MOVE_SEMANTICS(HashTable) {
+        _destroy_table();
+        HashTable::Alloc_::_alloc_take(ds);
+
+        mHash_d = ds.mHash_d;
+        mEqual_d = ds.mEqual_d;
+        mCtrl_d = ds.mCtrl_d;
+        mSlots_d = ds.mSlots_d;
+        mCapacity_d = ds.mCapacity_d;
+        mSlotNum_d = ds.mSlotNum_d;
+        mShift_d = ds.mShift_d;
+        mSize_d = ds.mSize_d;
+        mGrowAt_d = ds.mGrowAt_d;
+        mMaxLoadFactor_d = ds.mMaxLoadFactor_d;
+
+        ds.mCtrl_d = nullptr;
+        ds.mSlots_d = nullptr;
+        ds.mCapacity_d = ds.mSlotNum_d = ds.mSize_d = ds.mGrowAt_d = 0;
+        ds.mShift_d = 64;
+
+        return *this;
+    }
+
+    ~HashTable() {
+        _destroy_table();
+    }
+
+public: // Capacity
+    bool empty() const {
+        return mSize_d == 0;
+    }
+
+    typename HashTable::SizeType size() const {
+        return mSize_d;
+    }
+
+    // home buckets, the table holds up to capacity * max_load_factor objs before grow
+    typename HashTable::SizeType capacity() const {
+        return mCapacity_d;
+    }
+
+    float load_factor() const {
+        return mCapacity_d ? static_cast<float>(mSize_d) / mCapacity_d : 0.0f;
+    }
+
+    float max_load_factor() const {
+        return mMaxLoadFactor_d;
+    }
+
+    // (0, 1), higher: less memory, longer probe - take effect at next grow/reserve
+    void max_load_factor(float factor) {
+        DSTRUCT_ASSERT(factor > 0.0f && factor < 1.0f);
+        mMaxLoadFactor_d = factor;
+        mGrowAt_d = _grow_at(mCapacity_d);
+    }
+
+    // make room for n objs without rehash
+    void reserve(typename HashTable::SizeType n) {
+        SizeType_ newCapacity = mCapacity_d ? mCapacity_d : MIN_CAPACITY;
+        while (_grow_at(newCapacity) < n) newCapacity *= 2;
+        if (newCapacity > mCapacity_d) _rehash(newCapacity);
+    }
+
+public: // Modifiers
+    // insert if not exist
+    void push(const T &obj) {
+        _insert(obj);
+    }
+
+    void push(T &&obj) {
+        _insert(dstruct::move(obj));
+    }
+
+    void pop(const T &obj) {
+        _pop_by_key(obj);
+    }
+
+    typename HashTable::ConstIteratorType erase(typename HashTable::ConstIteratorType it) {
+        SizeType_ pos = it._get_ctrl_pointer() - mCtrl_d;
+        DSTRUCT_ASSERT(pos < mSlotNum_d && mCtrl_d[pos] != 0);
+        _erase(pos);
+        // backward shift: the next obj is moved to pos
+        return _create_iterator(pos);
+    }
+
+    void clear() {
+        for (SizeType_ i = 0; i < mSlotNum_d; i++) {
+            if (mCtrl_d[i]) {
+                dstruct::destroy(mSlots_d + i);
+                mCtrl_d[i] = 0;
+            }
+        }
+        mSize_d = 0;
+    }
+
+public: // Lookup
+    typename HashTable::ConstIteratorType find(const T &obj) const {
+        return _find_by_key(obj);
+    }
+
+    bool contains(const T &obj) const {
+        return _find(obj) != mSlotNum_d;
+    }
+
+public: // range-for and iterator
+    typename HashTable::ConstIteratorType begin() const {
+        return mSize_d ? _create_iterator(0) : end();
+    }
+
+    typename HashTable::ConstIteratorType end() const {
+        return typename HashTable::ConstIteratorType(mSlots_d + mSlotNum_d, mCtrl_d + mSlotNum_d);
+    }
+
+protected:
+    using SizeType_ = unsigned long long;
+
+    Hash mHash_d;
+    Equal mEqual_d;
+    Ctrl_ *mCtrl_d;
+    T *mSlots_d;
+    SizeType_ mCapacity_d;  // power of 2
+    SizeType_ mSlotNum_d;   // capacity + tail
+    int mShift_d;           // 64 - log2(capacity)
+    SizeType_ mSize_d;
+    SizeType_ mGrowAt_d;
+    float mMaxLoadFactor_d;
+
+    template <typename K>
+    SizeType_ _home(const K &obj) const {
+        return (mHash_d(obj) * 0x9E3779B97F4A7C15ULL) >> mShift_d;
+    }
+
+    SizeType_ _grow_at(SizeType_ capacity) const {
+        return static_cast<SizeType_>(capacity * mMaxLoadFactor_d);
+    }
+
+    typename HashTable::ConstIteratorType _create_iterator(SizeType_ pos) const {
+        typename HashTable::ConstIteratorType it(mSlots_d + pos, mCtrl_d + pos);
+        it._skip_empty();
+        return it;
+    }
+
+    // return mSlotNum_d if not found
+    template <typename K>
+    SizeType_ _find(const K &obj) const {
+        if (mSize_d == 0) return mSlotNum_d;
+        SizeType_ pos;
+        Ctrl_ ctrl;
+        return _probe(obj, pos, ctrl) ? pos : mSlotNum_d;
+    }
+
+    // true: found at pos, false: pos/ctrl is the insert position and its ctrl
+    // obj: T, or a type Hash/Equal accept with T(e.g. the key of KeyValue)
+    template <typename K>
+    bool _probe(const K &obj, SizeType_ &pos, Ctrl_ &ctrl) const {
+        pos = _home(obj);
+        ctrl = 1;
+#ifdef DSTRUCT_SIMD_SSE2
+        // home slot first, it decides most lookups at a low load factor
+        if (mCtrl_d[pos] == 0) return false;
+        if (mCtrl_d[pos] == 1 && mEqual_d(mSlots_d[pos], obj)) return true;
+        pos++; ctrl++;
+
+        const __m128i step = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        while (true) {
+            __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mCtrl_d + pos));
+            __m128i expected = _mm_add_epi8(_mm_set1_epi8(static_cast<char>(ctrl)), step);
+            // ctrl <= DIST_LIMIT + 1 and expected < 128, signed compare is fine(END_CTRL is -1: stop)
+            unsigned int match = _mm_movemask_epi8(_mm_cmpeq_epi8(group, expected));
+            unsigned int stop = _mm_movemask_epi8(_mm_cmplt_epi8(group, expected));
+            if (stop) match &= (stop & (0u - stop)) - 1; // only before the first stop
+
+            while (match) {
+                int i = dstruct::count_trailing_zeros(match);
+                if (mEqual_d(mSlots_d[pos + i], obj)) {
+                    pos += i;
+                    return true;
+                }
+                match &= match - 1;
+            }
+
+            if (stop) {
+                int i = dstruct::count_trailing_zeros(stop);
+                pos += i;
+                ctrl += i;
+                return false;
+            }
+            pos += GROUP_SIZE;
+            ctrl += GROUP_SIZE;
+        }
+#else
+        while (mCtrl_d[pos] >= ctrl) {
+            if (mCtrl_d[pos] == ctrl && mEqual_d(mSlots_d[pos], obj)) return true;
+            pos++; ctrl++;
+        }
+        return false;
+#endif
+    }
+
+public: // for Map
+    // one probe: return the obj equal to key, or create one by make(T *addr)
+    template <typename K, typename Make>
+    typename HashTable::ConstIteratorType
+    _find_or_insert(const K &key, const Make &make, bool &inserted) {
+        SizeType_ pos = _find_or_insert_pos(key, make, inserted);
+        return _create_iterator(pos);
+    }
+
+    // lookup/remove by key, no T is built for the probe
+    template <typename K>
+    typename HashTable::ConstIteratorType _find_by_key(const K &key) const {
+        SizeType_ pos = _find(key);
+        return pos == mSlotNum_d ? end() : _create_iterator(pos);
+    }
+
+    template <typename K>
+    void _pop_by_key(const K &key) {
+        SizeType_ pos = _find(key);
+        if (pos != mSlotNum_d) _erase(pos);
+    }
+
+protected:
+    template <typename U>
+    SizeType_ _insert(U &&obj) {
+        bool inserted;
+        return _find_or_insert_pos(obj, [&obj](T *addr) {
+            dstruct::construct(addr, dstruct::forward<U>(obj));
+        }, inserted);
+    }
+
+    template <typename K, typename Make>
+    SizeType_ _find_or_insert_pos(const K &key, const Make &make, bool &inserted) {
+        inserted = false;
+        while (true) {
+            // the table may not exist yet, _place must not see garbage then
+            SizeType_ pos = 0;
+            Ctrl_ ctrl = 1;
+            // only grow when key isn't exist
+            if (mCtrl_d != nullptr && _probe(key, pos, ctrl)) return pos;
+
+            if (mSize_d + 1 > mGrowAt_d) {
+                _rehash(mCapacity_d ? mCapacity_d * 2 : MIN_CAPACITY);
+                continue;
+            }
+
+            if (_place(pos, ctrl, make)) {
+                mSize_d++;
+                inserted = true;
+                return pos;
+            }
+
+            // probe too long or tail is full
+            DSTRUCT_ASSERT(mSize_d >= (mCapacity_d >> 4)); // Hash is too poor, e.g. many equal hash value
+            _rehash(mCapacity_d * 2);
+        }
+    }
+
+    // put the obj created by make(T *addr) at pos with ctrl, shift the followed objs of the cluster right
+    template <typename Make>
+    bool _place(SizeType_ pos, Ctrl_ ctrl, const Make &make) {
+        if (ctrl > DIST_LIMIT + 1 || pos >= mSlotNum_d) return false;
+
+        SizeType_ emptyPos = pos;
+        while (mCtrl_d[emptyPos] != 0) {
+            if (mCtrl_d[emptyPos] == DIST_LIMIT + 1 || emptyPos + 1 >= mSlotNum_d) return false;
+            emptyPos++;
+        }
+
+        if (IsTriviallyRelocatable<T>::value) {
+            dstruct::mem_move(mSlots_d + pos + 1, mSlots_d + pos, (emptyPos - pos) * sizeof(T));
+        } else {
+            for (SizeType_ i = emptyPos; i > pos; i--) {
+                dstruct::construct(mSlots_d + i, dstruct::move(mSlots_d[i - 1]));
+                dstruct::destroy(mSlots_d + i - 1);
+            }
+        }
+        for (SizeType_ i = emptyPos; i > pos; i--) {
+            mCtrl_d[i] = mCtrl_d[i - 1] + 1;
+        }
+
+        make(mSlots_d + pos);
+        mCtrl_d[pos] = ctrl;
+        return true;
+    }
+
+    void _erase(SizeType_ pos) {
+        dstruct::destroy(mSlots_d + pos);
+
+        SizeType_ last = pos + 1; // [pos + 1, last) will be moved left
+        while (last < mSlotNum_d && mCtrl_d[last] > 1) last++;
+
+        if (IsTriviallyRelocatable<T>::value) {
+            dstruct::mem_move(mSlots_d + pos, mSlots_d + pos + 1, (last - pos - 1) * sizeof(T));
+        } else {
+            for (SizeType_ i = pos + 1; i < last; i++) {
+                dstruct::construct(mSlots_d + i - 1, dstruct::move(mSlots_d[i]));
+                dstruct::destroy(mSlots_d + i);
+            }
+        }
+        for (SizeType_ i = pos + 1; i < last; i++) {
+            mCtrl_d[i - 1] = mCtrl_d[i] - 1;
+        }
+        mCtrl_d[last - 1] = 0;
+
+        mSize_d--;
+    }
+
+    void _create_table(SizeType_ capacity) {
+        mCapacity_d = capacity;
+        mSlotNum_d = capacity + (capacity < DIST_LIMIT ? capacity : DIST_LIMIT);
+        mShift_d = 64 - dstruct::floor_log2(capacity);
+        mGrowAt_d = _grow_at(capacity);
+        mSize_d = 0;
+
+        int ctrlBytes = static_cast<int>(mSlotNum_d + 1 + GROUP_SIZE);
+        mCtrl_d = AllocCtrl_(*this).allocate(ctrlBytes);
+        mSlots_d = AllocSlot_(*this).allocate(static_cast<int>(mSlotNum_d));
+        DSTRUCT_ASSERT(mCtrl_d != nullptr && mSlots_d != nullptr);
+
+        for (int i = 0; i < ctrlBytes; i++) mCtrl_d[i] = 0;
+        mCtrl_d[mSlotNum_d] = END_CTRL; // stop the iterator
+    }
+
+    void _destroy_table() {
+        if (mCtrl_d == nullptr) return;
+        clear();
+        AllocCtrl_(*this).deallocate(mCtrl_d, static_cast<int>(mSlotNum_d + 1 + GROUP_SIZE));
+        AllocSlot_(*this).deallocate(mSlots_d, static_cast<int>(mSlotNum_d));
+        mCtrl_d = nullptr;
+        mSlots_d = nullptr;
+        mCapacity_d = mSlotNum_d = mSize_d = mGrowAt_d = 0;
+        mShift_d = 64;
+    }
+
+    void _rehash(SizeType_ newCapacity) {
+        Ctrl_ *oldCtrl = mCtrl_d;
+        T *oldSlots = mSlots_d;
+        SizeType_ oldSlotNum = mSlotNum_d, oldSize = mSize_d;
+
+        _create_table(newCapacity);
+
+        // old objs are unique and in home order, so no equal check
+        for (SizeType_ i = 0; i < oldSlotNum; i++) {
+            if (oldCtrl[i] == 0) continue;
+            SizeType_ pos = _home(oldSlots[i]);
+            Ctrl_ expected = 1;
+            while (mCtrl_d[pos] >= expected) { pos++; expected++; }
+            T &obj = oldSlots[i];
+            bool placed = _place(pos, expected, [&obj](T *addr) {
+                dstruct::construct(addr, dstruct::move(obj));
+            });
+            DSTRUCT_ASSERT(placed); // Hash is too poor
+            dstruct::destroy(oldSlots + i);
+        }
+        mSize_d = oldSize;
+
+        if (oldCtrl) {
+            AllocCtrl_(*this).deallocate(oldCtrl, static_cast<int>(oldSlotNum + 1 + GROUP_SIZE));
+            AllocSlot_(*this).deallocate(oldSlots, static_cast<int>(oldSlotNum));
+        }
+    }
+};
+
+}
+
+#endif
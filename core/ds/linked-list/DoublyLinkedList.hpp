@@ -71,10 +71,12 @@ protected:
 public: // big five
     // use List_ to complete
     DoublyLinkedList() = default;
+    explicit DoublyLinkedList(Alloc &alloc) : List_(alloc) { }
     DoublyLinkedList(size_t n, const T &obj) : DoublyLinkedList() { while(n--) push_back(obj); }
 
     DSTRUCT_COPY_SEMANTICS(DoublyLinkedList) {
         clear();
+        DoublyLinkedList::Alloc_::_alloc_inherit(ds);
         // copy
         for (auto it = ds.begin(); it != ds.end(); it++) {
             push_back(*it);
@@ -103,7 +105,7 @@ public: // base op
 
     void push_back(const T &obj) {
         // 1. alloc memory
-        Node_ *nPtr = AllocNode_::allocate();
+        Node_ *nPtr = AllocNode_(*this).allocate();
         // 2. construct node
         mHeadNode_d.data = obj; // only for contruct nPtr
         dstruct::construct(nPtr, mHeadNode_d);
@@ -123,7 +125,7 @@ public: // base op
         Node_ *nPtr = Node_::to_node(lPtr);
         // 4. free and decrease size/len
         dstruct::destroy(nPtr);
-        AllocNode_::deallocate(nPtr);
+        AllocNode_(*this).deallocate(nPtr);
         mSize_d--;
     }
 
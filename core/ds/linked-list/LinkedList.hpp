@@ -39,6 +39,11 @@ public: // big five
         mSize_d = 0;
     }
 
+    explicit LinkedList_(Alloc &alloc) : LinkedList_::DStructTypeSpec { alloc } {
+        Node_::init(&mHeadNode_d);
+        mSize_d = 0;
+    }
+
     // copy/move-action impl in subclass
     LinkedList_(const LinkedList_ &list) = delete;
     LinkedList_ & operator=(const LinkedList_ &list) = delete;
@@ -46,6 +51,7 @@ public: // big five
     DSTRUCT_MOVE_SEMANTICS(LinkedList_) {
         // 1._clear
         _clear();
+        LinkedList_::Alloc_::_alloc_take(ds);
         // 2.only move data
         LinkedList_::mHeadNode_d = ds.mHeadNode_d;
         LinkedList_::mSize_d = ds.mSize_d;
@@ -88,7 +94,7 @@ public: // Modifiers
 
     void push_front(const T &obj) {
         // 1. alloc and construct node
-        Node_ *nPtr = AllocNode_::allocate();
+        Node_ *nPtr = AllocNode_(*this).allocate();
         mHeadNode_d.data = obj; // only for contruct nPtr
         dstruct::construct(nPtr, mHeadNode_d);
         // 2. add to list
@@ -111,7 +117,7 @@ public: // Modifiers
         Node_ *nPtr = Node_::to_node(lPtr);
         // 4. free and decrease size/len
         dstruct::destroy(nPtr);
-        AllocNode_::deallocate(nPtr);
+        AllocNode_(*this).deallocate(nPtr);
         mSize_d--;
     }
 
@@ -60,6 +60,8 @@ public: // big five
 
     }
 
+    explicit SinglyLinkedList(Alloc &alloc) : List_(alloc), mTailNodePtr_d { &mHeadNode_d } { }
+
     SinglyLinkedList(size_t n, const T &obj) : SinglyLinkedList() {
         while (n--) {
             push_back(obj);
@@ -68,6 +70,7 @@ public: // big five
 
     DSTRUCT_COPY_SEMANTICS(SinglyLinkedList) {
         clear();
+        SinglyLinkedList::Alloc_::_alloc_inherit(ds);
         // copy
         if (ds.mSize_d != 0) {
             auto linkPtr =  ds.mHeadNode_d.link.next;
@@ -105,7 +108,7 @@ public:
 
     void push_back(const T &obj) {
         // 1. alloc and construct node
-        Node_ *nPtr = AllocNode_::allocate();
+        Node_ *nPtr = AllocNode_(*this).allocate();
         this->mHeadNode_d.data = obj; // only for contruct nPtr
         dstruct::construct(nPtr, this->mHeadNode_d);
         // 2. add to list
@@ -142,7 +145,7 @@ public: // low efficient
         }
         //free and decrease size/len
         dstruct::destroy(mTailNodePtr_d);
-        AllocNode_::deallocate(mTailNodePtr_d);
+        AllocNode_(*this).deallocate(mTailNodePtr_d);
         this->mSize_d--;
         // update mTailNodePtr_d and link
         mTailNodePtr_d = Node_::to_node(link);
@@ -20,13 +20,13 @@ namespace dstruct {
 template <typename T, size_t ARR_SIZE, typename Alloc = dstruct::Alloc>
 class DoubleEndedQueue;
 
-template <typename T, size_t ARR_SIZE>
+template <typename T, size_t ARR_SIZE, typename Alloc = dstruct::Alloc>
 class DoubleEndedQueueIterator_ : public DStructIteratorTypeSpec<T, RandomIterator> {
-    friend class DoubleEndedQueue<T, ARR_SIZE, dstruct::Alloc>;
-    friend class DoubleEndedQueueIterator_<const T, ARR_SIZE>; // for it -> const-it
+    friend class DoubleEndedQueue<T, ARR_SIZE, Alloc>;
+    friend class DoubleEndedQueueIterator_<const T, ARR_SIZE, Alloc>; // for it -> const-it
 protected:
     using Array_         = dstruct::Array<T, ARR_SIZE>;
-    using ArrMapTable_   = dstruct::Vector<Array_ *>;
+    using ArrMapTable_   = dstruct::Vector<Array_ *, Alloc>;
 private:
     using Self = DoubleEndedQueueIterator_;
 
@@ -75,7 +75,7 @@ public:
 
     // for it -> const-it
     DoubleEndedQueueIterator_(
-        const DoubleEndedQueueIterator_<typename RemoveConst<T>::Type, ARR_SIZE> &obj,
+        const DoubleEndedQueueIterator_<typename RemoveConst<T>::Type, ARR_SIZE, Alloc> &obj,
         bool _unsedFlag // constructor dispatch flag
     ) : DoubleEndedQueueIterator_() {
 
@@ -122,25 +122,44 @@ public: // BidirectionalIterator
         return oldSelf;
     }
 
-public: // RandomIterator
+public: // RandomIterator - O(1), by position arithmetic on map table
     Self operator+(int n) const {
-        if (n < 0) {
-            return operator-(-n);
-        }
         Self self = *this;
-        while (n--) { self++; }
+        self._set_position(_position() + n);
         return self;
     };
 
     Self operator-(int n) const {
-        if (n < 0) {
-            return operator+(-n);
-        }
-        Self self = *this;
-        while (n--) { self--; }
-        return self;
+        return operator+(-n);
     };
 
+    typename Self::DifferenceType operator-(const Self &it) const {
+        return _position() - it._position();
+    }
+
+private:
+    // absolute position in map table: mapIndex * ARR_SIZE + arrIndex
+    long long _position() const {
+        return static_cast<long long>(mCurrMapIndex_d * ARR_SIZE) +
+            (mCurr_d - (*mArrMapTablePtr_d)[mCurrMapIndex_d]->begin());
+    }
+
+    // request: 0 <= pos <= ARR_SIZE * map-table-size
+    void _set_position(long long pos) {
+        DSTRUCT_ASSERT(pos >= 0);
+        size_t mapIndex = pos / ARR_SIZE;
+        size_t arrIndex = pos % ARR_SIZE;
+        if (mapIndex == (*mArrMapTablePtr_d).capacity()) {
+            // same as operator++: only stop at end() of the last array
+            mapIndex--;
+            arrIndex = ARR_SIZE;
+        }
+        DSTRUCT_ASSERT(mapIndex < (*mArrMapTablePtr_d).capacity());
+        mCurrMapIndex_d = mapIndex;
+        mCurr_d = (*mArrMapTablePtr_d)[mapIndex]->begin() + static_cast<int>(arrIndex);
+        _sync();
+    }
+
 private:
     // update mLNodePtr_d and mPointer_d
     void _sync() {
@@ -157,12 +176,12 @@ protected:
  
 template <typename T, size_t ARR_SIZE, typename Alloc>
 class DoubleEndedQueue :
-    public DStructTypeSpec<T, Alloc, DoubleEndedQueueIterator_<T, ARR_SIZE>, DoubleEndedQueueIterator_<const T, ARR_SIZE>> {
+    public DStructTypeSpec<T, Alloc, DoubleEndedQueueIterator_<T, ARR_SIZE, Alloc>, DoubleEndedQueueIterator_<const T, ARR_SIZE, Alloc>> {
 
 protected:
     using Array_         = Array<T, ARR_SIZE>;
     using AllocArray_    = dstruct::AllocSpec<Array_, Alloc>;
-    using ArrMapTable_   = Vector<Array_ *>;
+    using ArrMapTable_   = Vector<Array_ *, Alloc>;
 /*
     struct Block_ {
         typename ArrMapTable_::IteratorType arr; // point to Array
@@ -173,8 +192,14 @@ protected:
 public:
     DoubleEndedQueue() : mSize_d { 0 }, mCapacity_d { 0 } { }
 
+    explicit DoubleEndedQueue(Alloc &alloc) : DoubleEndedQueue::DStructTypeSpec { alloc },
+        mSize_d { 0 }, mCapacity_d { 0 }, mArrMapTable_d(alloc), mSpareArrs_d(alloc) { }
+
     DSTRUCT_COPY_SEMANTICS(DoubleEndedQueue) {
         _only_clear();
+        DoubleEndedQueue::Alloc_::_alloc_inherit(ds);
+        mArrMapTable_d = ArrMapTable_(*this); // map-table use the same alloc-instance
+        mSpareArrs_d = ArrMapTable_(*this);
 
         for (auto &obj : ds) { // TODO: optimize
             push_back(obj);
@@ -185,17 +210,21 @@ public:
 
     DSTRUCT_MOVE_SEMANTICS(DoubleEndedQueue) {
         _only_clear();
+        DoubleEndedQueue::Alloc_::_alloc_take(ds);
 
         // move
         mSize_d = ds.mSize_d;
         mCapacity_d = ds.mCapacity_d;
         mArrMapTable_d = dstruct::move(ds.mArrMapTable_d);
+        mSpareArrs_d = dstruct::move(ds.mSpareArrs_d);
         mBegin_d = dstruct::move(ds.mBegin_d);
         mEnd_d = dstruct::move(ds.mEnd_d);
+        mBegin_d.mArrMapTablePtr_d = mEnd_d.mArrMapTablePtr_d = &mArrMapTable_d;
 
         // reset ds
         ds.mSize_d = ds.mCapacity_d = 0;
         ds.mArrMapTable_d.clear();
+        ds.mSpareArrs_d.clear();
 
         return *this;
     }
@@ -245,7 +274,7 @@ public: // push/pop
             DSTRUCT_ASSERT(mArrMapTable_d.empty());
             _only_init();
         } else if (mEnd_d.mCurr_d == mArrMapTable_d.back()->end()) {
-            _resize(mCapacity_d * 2);
+            _remap_for_push();
         }
         dstruct::construct(&(*mEnd_d), obj);
         mEnd_d++;
@@ -257,7 +286,7 @@ public: // push/pop
             DSTRUCT_ASSERT(mArrMapTable_d.empty());
             _only_init();
         } else if (mBegin_d.mCurr_d == mArrMapTable_d[0]->begin()) {
-            _resize(mCapacity_d * 2);
+            _remap_for_push();
         }
         mBegin_d--;
         dstruct::construct(mBegin_d.operator->(), obj);
@@ -272,18 +301,14 @@ public: // push/pop
         mEnd_d--;
         mSize_d--;
         dstruct::destroy(mEnd_d.operator->());
-        if (mSize_d <= mCapacity_d / 3 && mArrMapTable_d.capacity() > MIN_MAP_TABLE_SIZE) {
-            _resize(mCapacity_d / 2);
-        }
+        _remap_for_pop();
     }
 
     void pop_front() {
         dstruct::destroy(&(*(mBegin_d)));
         mBegin_d++;
         mSize_d--;
-        if (mSize_d <= mCapacity_d / 3 && mArrMapTable_d.capacity() > MIN_MAP_TABLE_SIZE) {
-            _resize(mCapacity_d / 2);
-        }
+        _remap_for_pop();
     }
 
     void clear() {
@@ -292,6 +317,13 @@ public: // push/pop
     }
 
 public: // iterator/range-for support
+    typename DoubleEndedQueue::IteratorType begin() {
+        return mBegin_d;
+    }
+
+    typename DoubleEndedQueue::IteratorType end() {
+        return mEnd_d;
+    }
 
     typename DoubleEndedQueue::ConstIteratorType begin() const {
         return typename DoubleEndedQueue::ConstIteratorType(mBegin_d, true);
@@ -305,6 +337,7 @@ protected:
     //B_lock_ mFirst_d, mEnd_d;
     typename DoubleEndedQueue::SizeType mSize_d, mCapacity_d;
     ArrMapTable_ mArrMapTable_d;
+    ArrMapTable_ mSpareArrs_d; // recycled arrays, reused before allocate
     typename DoubleEndedQueue::IteratorType mBegin_d, mEnd_d;
 
     void _only_clear() {
@@ -317,8 +350,12 @@ protected:
 
             // release memory
             for (auto arrPtr : mArrMapTable_d) {
-                AllocArray_::deallocate(arrPtr);
+                AllocArray_(*this).deallocate(arrPtr);
+            }
+            for (auto arrPtr : mSpareArrs_d) {
+                AllocArray_(*this).deallocate(arrPtr);
             }
+            mSpareArrs_d.clear();
 
             // reset
             mSize_d = mCapacity_d = 0;
@@ -337,76 +374,112 @@ protected:
         mArrMapTable_d.resize(MIN_MAP_TABLE_SIZE, nullptr);
         // alloc arr and fill map-table
         for (int i = 0; i < MIN_MAP_TABLE_SIZE; i++) {
-            mArrMapTable_d[i] = AllocArray_::allocate();
-            dstruct::construct(mArrMapTable_d[i], Array_());
+            mArrMapTable_d[i] = _get_arr();
         }
         auto midMapIndex = MIN_MAP_TABLE_SIZE / 2;
         mBegin_d = mEnd_d = decltype(mBegin_d)(midMapIndex, 0, &mArrMapTable_d);
 
     }
 
-    /* (temp)request1: n % ARR_SIZE == 0 */
-    /* request2: mSize_d < (n and mCapacity_d) */
-    // (newCapacity - mSize_d) / ARR_SIZE >= 2
-    // mSize_d = oldCapacity / X
-    // newCapacity = oldCapacity / 2
-    void _resize(size_t n) {
-
-        bool needUpdateEndCurrIt { false };
-        bool isExtend = mCapacity_d < n;
-        size_t newMapTableSize = n / ARR_SIZE;
-        size_t oldArrStartIndex = mBegin_d.mCurrMapIndex_d;
-        size_t oldArrEndIndex = mEnd_d.mCurrMapIndex_d;
-        size_t arrNum = oldArrEndIndex - oldArrStartIndex;
-        size_t newArrStartIndex = ((n - mSize_d) / 2) / ARR_SIZE;
-        size_t newArrEndIndex = newArrStartIndex + arrNum;
-
-        // request: n / ARR_SIZE <= ((mSize_d - 1 - 1) / ARR_SIZE + 1 + 1)
-        // n = y * oldCapacity  
-        if (!isExtend && newMapTableSize >= arrNum) {
-            // when arrNum = ((mSize_d - 1 - 1) / ARR_SIZE + 1 + 1)
-            // exist newMapTableSize < arrNum
-            return;
+    // arrays from mBegin_d to mEnd_d(include)
+    size_t _used_arr_num() const {
+        return mEnd_d.mCurrMapIndex_d - mBegin_d.mCurrMapIndex_d + 1;
+    }
+
+    // request: mBegin_d or mEnd_d reach the boundary of map table
+    void _remap_for_push() {
+        size_t mapSize = mArrMapTable_d.size();
+        // enough free arrays on the other side: only re-centre, no allocation
+        _remap(_used_arr_num() * 2 < mapSize ? mapSize : mapSize * 2);
+    }
+
+    // shrink at 1/8 usage, keep a gap with grow(1/2) to avoid remap thrash
+    void _remap_for_pop() {
+        size_t mapSize = mArrMapTable_d.size();
+        if (mapSize > MIN_MAP_TABLE_SIZE && _used_arr_num() * 8 < mapSize) {
+            _remap(mapSize / 2);
         }
+    }
 
-        ArrMapTable_ oldArrMapTable = mArrMapTable_d;
-        mArrMapTable_d.resize(newMapTableSize, nullptr);
+    /*
+    re-centre used arrays in a map table of newMapSize, element isn't moved
+        same size: rotate map table in place
+        grow:      new slots use spare arrays first, then allocate
+        shrink:    unused arrays go to spare cache(size <= old map table size)
+    request: _used_arr_num() * 2 <= newMapSize
+    */
+    void _remap(size_t newMapSize) {
+        size_t mapSize = mArrMapTable_d.size();
+        size_t beginIndex = mBegin_d.mCurrMapIndex_d;
+        size_t usedNum = _used_arr_num();
+        size_t newBeginIndex = (newMapSize - usedNum) / 2;
+
+        DSTRUCT_ASSERT(usedNum < newMapSize);
+
+        if (newMapSize == mapSize) {
+            // rotate right by shift: reverse all, then reverse [0, shift) and [shift, mapSize)
+            size_t shift = (newBeginIndex + mapSize - beginIndex) % mapSize;
+            _reverse_map(0, mapSize);
+            _reverse_map(0, shift);
+            _reverse_map(shift, mapSize);
+        } else {
+            ArrMapTable_ newArrMapTable(*this);
+            newArrMapTable.resize(newMapSize, nullptr);
+
+            for (size_t i = 0; i < mapSize; i++) {
+                if (i < beginIndex || beginIndex + usedNum <= i) {
+                    mSpareArrs_d.push_back(mArrMapTable_d[i]);
+                }
+            }
 
-        // build new map table
-        for (int i = 0; i < newMapTableSize ; i++) {
-            if (i < newArrStartIndex || newArrEndIndex < i) {
-                mArrMapTable_d[i] = AllocArray_::allocate();
-                dstruct::construct(mArrMapTable_d[i], Array_());
-            } else {
-                mArrMapTable_d[i] = oldArrMapTable[oldArrStartIndex + (i - newArrStartIndex)];
+            for (size_t i = 0; i < newMapSize; i++) {
+                if (i < newBeginIndex || newBeginIndex + usedNum <= i) {
+                    newArrMapTable[i] = _get_arr();
+                } else {
+                    newArrMapTable[i] = mArrMapTable_d[beginIndex + (i - newBeginIndex)];
+                }
             }
-        }
 
-        // release arr in old map table
-        for (int i = 0; i < oldArrMapTable.capacity() ; i++) {
-            if (i < oldArrStartIndex || oldArrEndIndex < i) {
-                //dstruct::destroy(oldArrMapTable[i]);
-                AllocArray_::deallocate(oldArrMapTable[i]);
+            while (mSpareArrs_d.size() > mapSize) {
+                AllocArray_(*this).deallocate(mSpareArrs_d.back());
+                mSpareArrs_d.pop_back();
             }
+
+            mArrMapTable_d = dstruct::move(newArrMapTable);
         }
 
-        // update iterator
-        mBegin_d.mCurrMapIndex_d = newArrStartIndex;
-        mEnd_d.mCurrMapIndex_d = newArrEndIndex;
+        // update iterator: only map index changed, arrays aren't moved
+        mBegin_d.mCurrMapIndex_d = newBeginIndex;
+        mEnd_d.mCurrMapIndex_d = newBeginIndex + usedNum - 1;
+        _normalize(mBegin_d);
+        _normalize(mEnd_d);
 
-        // boundary check
-        if (mEnd_d.mCurr_d == mArrMapTable_d[newArrEndIndex]->end()) {
-            mEnd_d.mCurrMapIndex_d++;
-            mEnd_d.mCurr_d = mArrMapTable_d[mEnd_d.mCurrMapIndex_d]->begin();
-            mEnd_d._sync();
+        mCapacity_d = newMapSize * ARR_SIZE;
+    }
 
-            // only if old_mEnd == mBegin_d
-            if (mBegin_d.mCurr_d == mArrMapTable_d[newArrEndIndex]->end()) {
-                mBegin_d = mEnd_d;
-            }
+    Array_ * _get_arr() {
+        if (!mSpareArrs_d.empty()) {
+            Array_ *arrPtr = mSpareArrs_d.back();
+            mSpareArrs_d.pop_back();
+            return arrPtr;
         }
+        // raw storage: element is constructed by push and destroyed by pop
+        return AllocArray_(*this).allocate();
+    }
 
-        mCapacity_d = n;
+    void _reverse_map(size_t first, size_t last) {
+        while (first + 1 < last) {
+            dstruct::swap(mArrMapTable_d[first++], mArrMapTable_d[--last]);
+        }
+    }
+
+    // same as iterator's operator++: only stop at end() of the last array
+    void _normalize(typename DoubleEndedQueue::IteratorType &it) {
+        if (it.mCurr_d == mArrMapTable_d[it.mCurrMapIndex_d]->end() &&
+            it.mCurrMapIndex_d + 1 < mArrMapTable_d.size()) {
+            it.mCurr_d = mArrMapTable_d[++(it.mCurrMapIndex_d)]->begin();
+        }
+        it._sync();
     }
 
 };
@@ -0,0 +1,202 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef MPMC_QUEUE_HPP_DSTRUCT
+#define MPMC_QUEUE_HPP_DSTRUCT
+
+#include <atomic>
+#include <thread>
+
+#include <core/common.hpp>
+
+namespace dstruct {
+
+/*
+MPMCQueue: lock-free bounded queue, multi producer / multi consumer (Vyukov)
+
+    mHead_d(consumers)          mTail_d(producers)
+        |                           |
+        V                           V
+    +--------+--------+--------+--------+--------+
+    | seq    | seq    | seq    | seq    | seq    |   cell seq for position pos:
+    | obj    | obj    | obj    |        |        |     seq == pos      -> writable
+    +--------+--------+--------+--------+--------+     seq == pos + 1  -> readable
+
+    push: CAS mTail_d pos -> pos + 1 to claim the cell, write obj, seq = pos + 1 (release)
+    pop:  CAS mHead_d pos -> pos + 1 to claim the cell, read obj, seq = pos + capacity (release)
+
+    producers only contend on mTail_d and consumers only on mHead_d,
+    and a slow thread only block the cell it claimed - no convoy like a mutex
+
+Note: capacity is round up to power of 2, T need move-constructible
+*/
+
+template <typename T, typename Alloc = dstruct::Alloc>
+class MPMCQueue : public DStructTypeSpec<T, Alloc, void, void /* no iterator: can't traverse concurrently */> {
+
+    struct Cell_ {
+        std::atomic<size_t> seq;
+        alignas(T) unsigned char data[sizeof(T)];
+    };
+
+    using AllocCell_ = AllocSpec<Cell_, Alloc>;
+
+    constexpr static int SPIN_NUM = 64;
+
+public: // big five
+    explicit MPMCQueue(size_t capacity) : mCapacity_d { _round_up(capacity) } {
+        _init();
+    }
+
+    MPMCQueue(size_t capacity, Alloc &alloc) : MPMCQueue::DStructTypeSpec { alloc },
+        mCapacity_d { _round_up(capacity) } {
+        _init();
+    }
+
+    // shared by threads, don't copy/move it
+    MPMCQueue(const MPMCQueue &) = delete;
+    MPMCQueue & operator=(const MPMCQueue &) = delete;
+
+    // request: no other thread is using it
+    ~MPMCQueue() {
+        size_t tail = mTail_d.load(std::memory_order_relaxed);
+        for (size_t pos = mHead_d.load(std::memory_order_relaxed); pos != tail; pos++) {
+            dstruct::destroy(_data(mCells_d[pos & (mCapacity_d - 1)]));
+        }
+        AllocCell_(*this).deallocate(mCells_d, mCapacity_d);
+    }
+
+public: // status - approximate when other thread is working
+    typename MPMCQueue::SizeType size() const {
+        size_t head = mHead_d.load(std::memory_order_acquire);
+        size_t tail = mTail_d.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    typename MPMCQueue::SizeType capacity() const {
+        return mCapacity_d;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+public: // non-blocking - return false when full/empty
+    bool try_push(typename MPMCQueue::ConstReferenceType obj) {
+        return _try_push(obj);
+    }
+
+    bool try_push(T &&obj) {
+        return _try_push(dstruct::move(obj));
+    }
+
+    bool try_pop(typename MPMCQueue::ReferenceType obj) {
+        size_t pos = mHead_d.load(std::memory_order_relaxed);
+        Cell_ *cell;
+
+        while (true) {
+            cell = mCells_d + (pos & (mCapacity_d - 1));
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            long long diff = static_cast<long long>(seq - (pos + 1));
+            if (diff == 0) {
+                if (mHead_d.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false; // empty
+            } else {
+                pos = mHead_d.load(std::memory_order_relaxed); // other consumer took it
+            }
+        }
+
+        obj = dstruct::move(*_data(*cell));
+        dstruct::destroy(_data(*cell));
+        cell->seq.store(pos + mCapacity_d, std::memory_order_release); // writable for next round
+
+        return true;
+    }
+
+public: // blocking - spin, then yield cpu
+    void push(typename MPMCQueue::ConstReferenceType obj) {
+        int spinCnt = 0;
+        while (!_try_push(obj)) _backoff(spinCnt);
+    }
+
+    void push(T &&obj) {
+        int spinCnt = 0;
+        while (!_try_push(dstruct::move(obj))) _backoff(spinCnt);
+    }
+
+    void pop(typename MPMCQueue::ReferenceType obj) {
+        int spinCnt = 0;
+        while (!try_pop(obj)) _backoff(spinCnt);
+    }
+
+protected:
+    alignas(DSTRUCT_CACHE_LINE_SIZE) std::atomic<size_t> mHead_d;
+    alignas(DSTRUCT_CACHE_LINE_SIZE) std::atomic<size_t> mTail_d;
+    alignas(DSTRUCT_CACHE_LINE_SIZE) size_t mCapacity_d; // read-only after init
+    Cell_ *mCells_d;
+
+    static size_t _round_up(size_t capacity) {
+        DSTRUCT_ASSERT(capacity >= 1);
+        size_t n = 2;
+        while (n < capacity) n <<= 1;
+        return n;
+    }
+
+    static T * _data(Cell_ &cell) {
+        return reinterpret_cast<T *>(cell.data);
+    }
+
+    static void _backoff(int &spinCnt) {
+        if (++spinCnt > SPIN_NUM) {
+            spinCnt = 0;
+            std::this_thread::yield();
+        }
+    }
+
+    void _init() {
+        mHead_d.store(0, std::memory_order_relaxed);
+        mTail_d.store(0, std::memory_order_relaxed);
+        mCells_d = AllocCell_(*this).allocate(mCapacity_d);
+        DSTRUCT_ASSERT(mCells_d != nullptr);
+        for (size_t i = 0; i < mCapacity_d; i++) {
+            dstruct::construct(&(mCells_d[i].seq), i);
+        }
+    }
+
+    template <typename U>
+    bool _try_push(U &&obj) {
+        size_t pos = mTail_d.load(std::memory_order_relaxed);
+        Cell_ *cell;
+
+        while (true) {
+            cell = mCells_d + (pos & (mCapacity_d - 1));
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            long long diff = static_cast<long long>(seq - pos);
+            if (diff == 0) {
+                if (mTail_d.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false; // full
+            } else {
+                pos = mTail_d.load(std::memory_order_relaxed); // other producer took it
+            }
+        }
+
+        dstruct::construct(_data(*cell), dstruct::forward<U>(obj));
+        cell->seq.store(pos + 1, std::memory_order_release); // readable
+
+        return true;
+    }
+};
+
+}
+
+#endif
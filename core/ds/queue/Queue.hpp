@@ -25,6 +25,7 @@ class Queue {
 
 public:
     Queue() = default;
+    explicit Queue(AllocType &alloc) : mDS_d(alloc) { }
     Queue(const Queue &) = default;
     Queue & operator=(const Queue &) = default;
     Queue(Queue &&) = default;
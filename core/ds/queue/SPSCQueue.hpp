@@ -0,0 +1,171 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef SPSC_QUEUE_HPP_DSTRUCT
+#define SPSC_QUEUE_HPP_DSTRUCT
+
+#include <atomic>
+
+#include <core/common.hpp>
+#include <core/ds/array/Array.hpp>
+
+namespace dstruct {
+
+/*
+SPSCQueue: lock-free bounded ring queue, single producer / single consumer
+
+    mHead_d(consumer)       mTail_d(producer)
+        |                       |
+        V                       V
+    +-------+-------+-------+-------+-------+
+    |       |  obj  |  obj  |       |       |    mBuffer_d: Array<T, N>
+    +-------+-------+-------+-------+-------+
+
+    index:  head/tail only increase, slot = index & (N - 1)
+    sync:   producer store tail(release) -> consumer load tail(acquire), head is the same
+    cache:  each side keep a local copy of the other's index, reload only when full/empty
+    layout: head / tail / buffer in different cache lines, avoid false sharing
+
+Note:
+    push_* only be called by one thread(producer), pop_* only by one thread(consumer)
+    T need default-constructible and (move-)assignable, slot is reused by assignment
+*/
+
+template <typename T, size_t N>
+class SPSCQueue {
+
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "N isn't power of 2");
+
+    constexpr static size_t INDEX_MASK = N - 1;
+
+public:
+    using ValueType            = T;
+    using ReferenceType        = ValueType &;
+    using ConstReferenceType   = const ValueType &;
+    using SizeType             = size_t;
+
+public: // big five
+    SPSCQueue() : mHead_d { 0 }, mTailCache_d { 0 }, mTail_d { 0 }, mHeadCache_d { 0 } { }
+
+    // shared by threads, don't copy/move it
+    SPSCQueue(const SPSCQueue &) = delete;
+    SPSCQueue & operator=(const SPSCQueue &) = delete;
+
+    ~SPSCQueue() = default;
+
+public: // status - approximate when other thread is working
+    SizeType size() const {
+        size_t head = mHead_d.load(std::memory_order_acquire);
+        size_t tail = mTail_d.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    SizeType capacity() const {
+        return N;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+public: // producer - return false when full
+    bool push(ConstReferenceType obj) {
+        return _push(obj);
+    }
+
+    bool push(T &&obj) {
+        return _push(dstruct::move(obj));
+    }
+
+    // push objs[0, n) as much as possible, return pushed number
+    SizeType push_n(const T *objs, SizeType n) {
+        size_t tail = mTail_d.load(std::memory_order_relaxed);
+        if (N - (tail - mHeadCache_d) < n) {
+            mHeadCache_d = mHead_d.load(std::memory_order_acquire);
+        }
+
+        size_t freeNum = N - (tail - mHeadCache_d);
+        if (n > freeNum) n = freeNum;
+
+        for (size_t i = 0; i < n; i++) {
+            mBuffer_d[(tail + i) & INDEX_MASK] = objs[i];
+        }
+        mTail_d.store(tail + n, std::memory_order_release); // publish n objs at once
+
+        return n;
+    }
+
+public: // consumer - return false when empty
+    bool pop() {
+        size_t head;
+        if (!_readable(head)) return false;
+        mHead_d.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(ReferenceType obj) {
+        size_t head;
+        if (!_readable(head)) return false;
+        obj = dstruct::move(mBuffer_d[head & INDEX_MASK]);
+        mHead_d.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // pop to objs[0, n) as much as possible, return popped number
+    SizeType pop_n(T *objs, SizeType n) {
+        size_t head = mHead_d.load(std::memory_order_relaxed);
+        if (mTailCache_d - head < n) {
+            mTailCache_d = mTail_d.load(std::memory_order_acquire);
+        }
+
+        size_t usedNum = mTailCache_d - head;
+        if (n > usedNum) n = usedNum;
+
+        for (size_t i = 0; i < n; i++) {
+            objs[i] = dstruct::move(mBuffer_d[(head + i) & INDEX_MASK]);
+        }
+        mHead_d.store(head + n, std::memory_order_release); // give back n slots at once
+
+        return n;
+    }
+
+protected:
+    // consumer side
+    alignas(DSTRUCT_CACHE_LINE_SIZE) std::atomic<size_t> mHead_d;
+    size_t mTailCache_d;
+    // producer side
+    alignas(DSTRUCT_CACHE_LINE_SIZE) std::atomic<size_t> mTail_d;
+    size_t mHeadCache_d;
+    alignas(DSTRUCT_CACHE_LINE_SIZE) dstruct::Array<T, N> mBuffer_d;
+
+    template <typename U>
+    bool _push(U &&obj) {
+        size_t tail = mTail_d.load(std::memory_order_relaxed);
+        if (tail - mHeadCache_d == N) {
+            mHeadCache_d = mHead_d.load(std::memory_order_acquire);
+            if (tail - mHeadCache_d == N) return false;
+        }
+        mBuffer_d[tail & INDEX_MASK] = dstruct::forward<U>(obj);
+        mTail_d.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool _readable(size_t &head) {
+        head = mHead_d.load(std::memory_order_relaxed);
+        if (head == mTailCache_d) {
+            mTailCache_d = mTail_d.load(std::memory_order_acquire);
+            if (head == mTailCache_d) return false;
+        }
+        return true;
+    }
+};
+
+}
+
+#endif
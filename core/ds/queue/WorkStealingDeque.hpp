@@ -0,0 +1,213 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef WORK_STEALING_DEQUE_HPP_DSTRUCT
+#define WORK_STEALING_DEQUE_HPP_DSTRUCT
+
+#include <atomic>
+
+#include <core/common.hpp>
+
+namespace dstruct {
+
+/*
+WorkStealingDeque: Chase-Lev deque, one owner and many thieves
+
+          thieves: steal (FIFO)                  owner: push / pop (LIFO)
+                |                                   |
+                V                                   V
+    +-------+-------+-------+-------+-------+-------+-------+
+    |       | task  | task  | task  | task  |       |       |    circular array(growable)
+    +-------+-------+-------+-------+-------+-------+-------+
+                ^                               ^
+                mTop_d                          mBottom_d
+
+    push:  write at bottom, bottom + 1(release)          - no CAS
+    pop:   bottom - 1, CAS top only for the last task    - race with thieves
+    steal: read at top, CAS top + 1                      - race with owner/thieves
+    grow:  owner copy tasks to a 2x array, old array is retired(thieves may read it)
+           and released by ~WorkStealingDeque
+
+ref: Correct and Efficient Work-Stealing for Weak Memory Models (Le, Pop, Cohen, Nardelli)
+
+Note: T need trivially copyable(e.g. task pointer / index range), a thief read it before CAS
+      and small(<= 8 bytes) to keep std::atomic<T> lock-free
+*/
+
+template <typename T, typename Alloc = dstruct::Alloc>
+class WorkStealingDeque : public DStructTypeSpec<T, Alloc, void, void /* no iterator: can't traverse concurrently */> {
+
+    static_assert(IsTriviallyCopyable<T>::value, "T isn't trivially copyable");
+
+    struct Ring_ {
+        long long capacity; // power of 2
+        Ring_ *retired;     // old(small) arrays
+        std::atomic<T> *tasks;
+
+        T get(long long index) const {
+            return tasks[index & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+
+        void put(long long index, const T &task) {
+            tasks[index & (capacity - 1)].store(task, std::memory_order_relaxed);
+        }
+    };
+
+    using AllocByte_ = AllocSpec<unsigned char, Alloc>;
+
+    // tasks follow the header in the same block
+    constexpr static size_t RING_HEADER_SIZE =
+        (sizeof(Ring_) + alignof(std::atomic<T>) - 1) / alignof(std::atomic<T>) * alignof(std::atomic<T>);
+
+public: // big five
+    explicit WorkStealingDeque(size_t capacity = 64) : mTop_d { 0 }, mBottom_d { 0 } {
+        _init(capacity);
+    }
+
+    WorkStealingDeque(size_t capacity, Alloc &alloc) : WorkStealingDeque::DStructTypeSpec { alloc },
+        mTop_d { 0 }, mBottom_d { 0 } {
+        _init(capacity);
+    }
+
+    // shared by threads, don't copy/move it
+    WorkStealingDeque(const WorkStealingDeque &) = delete;
+    WorkStealingDeque & operator=(const WorkStealingDeque &) = delete;
+
+    // request: no other thread is using it
+    ~WorkStealingDeque() {
+        Ring_ *ring = mRing_d.load(std::memory_order_relaxed);
+        while (ring != nullptr) {
+            Ring_ *retired = ring->retired;
+            _free_ring(ring);
+            ring = retired;
+        }
+    }
+
+public: // status - approximate when other thread is working
+    typename WorkStealingDeque::SizeType size() const {
+        long long bottom = mBottom_d.load(std::memory_order_relaxed);
+        long long top = mTop_d.load(std::memory_order_relaxed);
+        return bottom > top ? bottom - top : 0;
+    }
+
+    typename WorkStealingDeque::SizeType capacity() const {
+        return mRing_d.load(std::memory_order_relaxed)->capacity;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+public: // owner
+    void push(typename WorkStealingDeque::ConstReferenceType task) {
+        long long bottom = mBottom_d.load(std::memory_order_relaxed);
+        long long top = mTop_d.load(std::memory_order_acquire);
+        Ring_ *ring = mRing_d.load(std::memory_order_relaxed);
+
+        if (bottom - top > ring->capacity - 1) {
+            ring = _grow(ring, top, bottom);
+        }
+
+        ring->put(bottom, task);
+        mBottom_d.store(bottom + 1, std::memory_order_release); // publish the task to thieves
+    }
+
+    // take the newest task, return false when empty
+    bool pop(typename WorkStealingDeque::ReferenceType task) {
+        long long bottom = mBottom_d.load(std::memory_order_relaxed) - 1;
+        Ring_ *ring = mRing_d.load(std::memory_order_relaxed);
+        mBottom_d.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long long top = mTop_d.load(std::memory_order_relaxed);
+
+        bool ok = true;
+        if (top <= bottom) {
+            task = ring->get(bottom);
+            if (top == bottom) { // the last one, race with thieves
+                ok = mTop_d.compare_exchange_strong(top, top + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+                mBottom_d.store(bottom + 1, std::memory_order_relaxed);
+            }
+        } else { // empty
+            ok = false;
+            mBottom_d.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return ok;
+    }
+
+public: // thief
+    // take the oldest task, return false when empty or lost the race
+    bool steal(typename WorkStealingDeque::ReferenceType task) {
+        long long top = mTop_d.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long long bottom = mBottom_d.load(std::memory_order_acquire);
+
+        if (top < bottom) {
+            Ring_ *ring = mRing_d.load(std::memory_order_acquire);
+            T stolen = ring->get(top);
+            if (!mTop_d.compare_exchange_strong(top, top + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return false;
+            }
+            task = stolen;
+            return true;
+        }
+
+        return false;
+    }
+
+protected:
+    alignas(DSTRUCT_CACHE_LINE_SIZE) std::atomic<long long> mTop_d;
+    alignas(DSTRUCT_CACHE_LINE_SIZE) std::atomic<long long> mBottom_d;
+    std::atomic<Ring_ *> mRing_d; // owner write, thieves read
+
+    void _init(size_t capacity) {
+        long long n = 2;
+        while (n < static_cast<long long>(capacity)) n <<= 1;
+        mRing_d.store(_alloc_ring(n, nullptr), std::memory_order_relaxed);
+    }
+
+    Ring_ * _alloc_ring(long long capacity, Ring_ *retired) {
+        size_t bytes = RING_HEADER_SIZE + capacity * sizeof(std::atomic<T>);
+        unsigned char *memPtr = AllocByte_(*this).allocate(bytes);
+        DSTRUCT_ASSERT(memPtr != nullptr);
+
+        Ring_ *ring = reinterpret_cast<Ring_ *>(memPtr);
+        ring->capacity = capacity;
+        ring->retired = retired;
+        ring->tasks = reinterpret_cast<std::atomic<T> *>(memPtr + RING_HEADER_SIZE);
+        for (long long i = 0; i < capacity; i++) {
+            dstruct::construct(ring->tasks + i);
+        }
+
+        return ring;
+    }
+
+    void _free_ring(Ring_ *ring) {
+        AllocByte_(*this).deallocate(
+            reinterpret_cast<unsigned char *>(ring),
+            RING_HEADER_SIZE + ring->capacity * sizeof(std::atomic<T>)
+        );
+    }
+
+    // only owner: copy [top, bottom) to a 2x array
+    Ring_ * _grow(Ring_ *ring, long long top, long long bottom) {
+        Ring_ *newRing = _alloc_ring(ring->capacity * 2, ring);
+        for (long long i = top; i < bottom; i++) {
+            newRing->put(i, ring->get(i));
+        }
+        mRing_d.store(newRing, std::memory_order_release);
+        return newRing;
+    }
+};
+
+}
+
+#endif
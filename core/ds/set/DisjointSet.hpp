@@ -25,6 +25,7 @@ private:
 
 public:
     DisjointSet(int n) : mArray_d(n, -1) { }
+    DisjointSet(int n, Alloc &alloc) : mArray_d(n, -1, alloc) { }
     DisjointSet(const DisjointSet &) = default;
     DisjointSet & operator=(const DisjointSet &) = default;
     DisjointSet(DisjointSet &&) = default;
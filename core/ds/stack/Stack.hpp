@@ -25,6 +25,7 @@ class Stack {
 
 public:
     Stack() = default;
+    explicit Stack(AllocType &alloc) : mDS_d(alloc) { }
     Stack(const Stack &) = default;
     Stack & operator=(const Stack &) = default;
     Stack(Stack &&) = default;
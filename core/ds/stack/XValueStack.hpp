@@ -26,6 +26,8 @@ class XValueStack {
 public:
     XValueStack() = default;
     XValueStack(const Compare &cmp) : mCmp_d { cmp } { }
+    explicit XValueStack(AllocType &alloc, const Compare &cmp = Compare()) :
+        mCmp_d { cmp }, mStack_d(alloc) { }
 
     DSTRUCT_COPY_SEMANTICS(XValueStack) {
         this->mXValue_d = ds.mXValue_d;
@@ -27,6 +27,10 @@ public:
         mCharList_d.resize(15);
     }
 
+    explicit BasicString(Alloc &alloc) : mCharList_d {1, '\0', alloc} {
+        mCharList_d.resize(15);
+    }
+
     DSTRUCT_COPY_SEMANTICS(BasicString) {
         mCharList_d = ds.mCharList_d;
         return *this;
@@ -153,6 +157,12 @@ operator+(const char *s1, const BasicString<CharType, Alloc> s2) {
     return operator+(BasicString<CharType, Alloc>(s1), s2);
 }
 
+// only hold a Vector, relocate by memcpy
+template <typename CharType, typename Alloc>
+struct IsTriviallyRelocatable<BasicString<CharType, Alloc>> {
+    const static bool value = true;
+};
+
 template <typename CharType, typename Alloc>
 static bool
 operator==(const BasicString<CharType, Alloc> s1, const BasicString<CharType, Alloc> s2) {
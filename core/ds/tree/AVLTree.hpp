@@ -108,6 +108,8 @@ public:
 
 public:
     AVLTree(CMP cmp = CMP()) : BinaryTree_e { nullptr, 0 }, mCmp_d { cmp } { }
+    explicit AVLTree(Alloc &alloc, CMP cmp = CMP()) :
+        BinaryTree_e { nullptr, 0, alloc }, mCmp_d { cmp } { }
 
 public:
     void push(const T &element) {
@@ -117,11 +119,7 @@ public:
     }
 
     void pop(const T &obj) {
-        if (BinaryTree_e::mSize_d == 0) return; // TODO: better method?
-        auto root = _delete(Node_::to_link(BinaryTree_e::mRootPtr_d), obj);
-        if (BinaryTree_e::mRootPtr_d != Node_::to_node(root)) {
-            BinaryTree_e::_update_root(root);
-        }
+        _pop_by_key(obj);
     }
 
 public:
@@ -158,6 +156,72 @@ public:
         return BinaryTree_e::mRootPtr_d ? BinaryTree_e::mRootPtr_d->data.height : 0;
     }
 
+    // one descent: return the obj equal to key, or create one by make(T *addr) at the leaf
+    // key: T, or a type CMP can compare with T(e.g. the key of KeyValue)
+    template <typename K, typename Make>
+    typename AVLTree::ConstIteratorType
+    _find_or_insert(const K &key, const Make &make, bool &inserted) {
+        typename Node_::LinkType *parent = nullptr;
+        typename Node_::LinkType *curr = Node_::to_link(BinaryTree_e::mRootPtr_d);
+        bool toLeft = false;
+        while (curr != nullptr) {
+            auto currNode = Node_::to_node(curr);
+            if (mCmp_d(key, currNode->data.val)) {
+                toLeft = true;
+            } else if (mCmp_d(currNode->data.val, key)) {
+                toLeft = false;
+            } else {
+                inserted = false;
+                return BinaryTree_e::_create_iterator(curr, TraversalType::InOrder);
+            }
+            parent = curr;
+            curr = toLeft ? curr->left : curr->right;
+        }
+
+        Node_ *node = AllocNode_(*this).allocate();
+        DSTRUCT_ASSERT(node != nullptr);
+        dstruct::construct(&(node->link), typename Node_::LinkType());
+        node->data.height = 1;
+        make(&(node->data.val));
+
+        auto link = Node_::to_link(node);
+        link->parent = parent;
+        if (parent == nullptr) {
+            BinaryTree_e::_update_root(link);
+        } else {
+            if (toLeft) parent->left = link;
+            else parent->right = link;
+            _update_height(parent);
+            _rebalance_upward(parent);
+        }
+        BinaryTree_e::mSize_d++;
+
+        inserted = true;
+        return BinaryTree_e::_create_iterator(link, TraversalType::InOrder);
+    }
+
+    // lookup/remove by key, no T is built for the compare
+    template <typename K>
+    typename AVLTree::ConstIteratorType _find_by_key(const K &key) const {
+        typename Node_::LinkType *curr = Node_::to_link(BinaryTree_e::mRootPtr_d);
+        while (curr != nullptr) {
+            const T &val = Node_::to_node(curr)->data.val;
+            if (mCmp_d(key, val)) curr = curr->left;
+            else if (mCmp_d(val, key)) curr = curr->right;
+            else break;
+        }
+        return BinaryTree_e::_create_iterator(curr, TraversalType::InOrder);
+    }
+
+    template <typename K>
+    void _pop_by_key(const K &key) {
+        if (BinaryTree_e::mSize_d == 0) return; // TODO: better method?
+        auto root = _delete(Node_::to_link(BinaryTree_e::mRootPtr_d), key);
+        if (BinaryTree_e::mRootPtr_d != Node_::to_node(root)) {
+            BinaryTree_e::_update_root(root);
+        }
+    }
+
 public: // range-for and iterator
 
     typename AVLTree::ConstIteratorType
@@ -189,7 +253,8 @@ protected:
         return root;
     }
 
-    void _rebalance_after_delete(typename Node_::LinkType *root) {
+    // root's height is updated, fix heights and rotate from root to tree-root(after delete/insert)
+    void _rebalance_upward(typename Node_::LinkType *root) {
         while (root != nullptr) {
             // bottom-up balance
             auto parent = root->parent;
@@ -214,7 +279,7 @@ protected:
     _insert(typename Node_::LinkType *root, const T &element, typename Node_::LinkType *parent = nullptr) {
         Node_ *rootNode = nullptr;
         if (root == nullptr) { // create node
-            rootNode = AllocNode_::allocate();
+            rootNode = AllocNode_(*this).allocate();
             dstruct::construct(rootNode, Node_(AVLData_<T>(element)));
             root = Node_::to_link(rootNode);
             root->parent = parent;
@@ -265,7 +330,7 @@ protected:
                     parent->right = nullptr;
                 }
                 _update_height(parent);
-                _rebalance_after_delete(parent);
+                _rebalance_upward(parent);
             }
 
             _real_delete(target);
@@ -287,7 +352,7 @@ protected:
                     parent->right = child;
                 }
                 _update_height(parent);
-                _rebalance_after_delete(parent);
+                _rebalance_upward(parent);
             }
 
             _real_delete(target);
@@ -296,7 +361,9 @@ protected:
         }
     }
 
-    typename Node_::LinkType * _delete(typename Node_::LinkType *root, const T &obj) {
+    template <typename K>
+    typename Node_::LinkType * _delete(typename Node_::LinkType *root, const K &obj) {
+        if (root == nullptr) return nullptr; // not found
         auto nPtr = Node_::to_node(root);
         if (mCmp_d(obj, nPtr->data.val)) {
             root->left = _delete(root->left, obj);
@@ -354,7 +421,7 @@ protected: // helper
     void _real_delete(typename Node_::LinkType *linkPtr) {
         auto nodePtr = Node_::to_node(linkPtr);
         dstruct::destroy(nodePtr);
-        AllocNode_::deallocate(nodePtr);
+        AllocNode_(*this).deallocate(nodePtr);
         BinaryTree_e::mSize_d--;
     }
 
@@ -445,7 +512,7 @@ protected: // helper
         auto rootNode = Node_::to_node(root);
         auto leftNode = Node_::to_node(root->left);
         leftNode->data.height = dstruct::max(_height(leftNode->link.left), _height(leftNode->link.right)) + 1;
-        rootNode->data.height = dstruct::max(leftNode->data.height, _height(rootNode->link.left)) + 1;
+        rootNode->data.height = dstruct::max(leftNode->data.height, _height(rootNode->link.right)) + 1;
         return root;
     }
 
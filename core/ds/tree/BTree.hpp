@@ -0,0 +1,649 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef BTREE_HPP_DSTRUCT
+#define BTREE_HPP_DSTRUCT
+
+#include <core/common.hpp>
+
+namespace dstruct {
+
+template <typename T>
+struct BTreeKey {
+    using KeyType = T;
+
+    const KeyType & operator()(const T &obj) const {
+        return obj;
+    }
+};
+
+// objs/keys per node, at least 4 - half full node can split/merge
+template <typename T, typename Key, int NodeBytes>
+struct BTreeNodeCap_ {
+    constexpr static int LEAF_RAW = static_cast<int>((NodeBytes - 3 * sizeof(void *)) / sizeof(T));
+    constexpr static int INNER_RAW = static_cast<int>((NodeBytes - 2 * sizeof(void *)) / (sizeof(Key) + sizeof(void *)));
+    constexpr static int LEAF = LEAF_RAW > 4 ? LEAF_RAW : 4;
+    constexpr static int INNER = INNER_RAW > 4 ? INNER_RAW : 4;
+};
+
+// objs are constructed in [0, count) of mem
+template <typename T, int N>
+struct BTreeLeaf_ {
+    int count;
+    BTreeLeaf_ *prev, *next;
+    alignas(T) unsigned char mem[N * sizeof(T)];
+
+    T * slots() { return reinterpret_cast<T *>(mem); }
+    const T * slots() const { return reinterpret_cast<const T *>(mem); }
+};
+
+// keys[i]: the min key of children[i + 1], children are inner or leaf(by level)
+template <typename Key, int N>
+struct BTreeInner_ {
+    int count; // keys, children is count + 1
+    void *children[N + 1];
+    alignas(Key) unsigned char mem[N * sizeof(Key)];
+
+    Key * keys() { return reinterpret_cast<Key *>(mem); }
+    const Key * keys() const { return reinterpret_cast<const Key *>(mem); }
+};
+
+template <typename T, int N>
+class BTreeIterator_ : public DStructIteratorTypeSpec<const T> {
+private:
+    using Self = BTreeIterator_;
+    using Leaf_ = BTreeLeaf_<T, N>;
+public:
+    BTreeIterator_(const Leaf_ *leaf = nullptr, int index = 0) : mLeaf_d { leaf }, mIndex_d { index } {
+        Self::mPointer_d = leaf ? leaf->slots() + index : nullptr;
+    }
+
+public: // ForwardIterator
+    Self& operator++() {
+        if (++mIndex_d < mLeaf_d->count) {
+            Self::mPointer_d++;
+        } else {
+            // next leaf, nullptr is end
+            mLeaf_d = mLeaf_d->next;
+            mIndex_d = 0;
+            Self::mPointer_d = mLeaf_d ? mLeaf_d->slots() : nullptr;
+        }
+        return *this;
+    }
+
+    Self operator++(int) {
+        Self old = *this;
+        ++(*this);
+        return old;
+    }
+
+private:
+    const Leaf_ *mLeaf_d;
+    int mIndex_d;
+};
+
+/*
+BTree: B+ tree, sorted objs in leaves, inner nodes only hold separator keys
+
+    node: about NodeBytes(a few cache lines), many keys per node - a lookup touches
+          height(log_fanout(n)) nodes instead of log2(n) scattered nodes of a binary tree
+
+                          inner: [   k2   |   k4   ]
+                                 /        |         \
+    leaves(linked): [k0 k1] <-> [k2 k3] <-> [k4 k5 k6] -> nullptr
+
+    keys[i - 1] <= keys in children[i] < keys[i]
+    find:  upper bound in inner nodes, lower bound in the leaf
+    push:  full leaf splits in half, the min key of right half is pushed to parent(may split up to root)
+    pop:   leaf under half full borrows from a sibling or merges with it(may merge up to root)
+    range: iterator walks the leaf list, objs of a leaf are contiguous
+
+    GetKey: KeyType + const KeyType & operator()(const T &), separator keys are copied to inner nodes
+
+Note:
+    iterator is invalidated by push/pop(objs move between leaves), erase return the next iterator
+    T's key must not be modified by iterator(const)
+usage:
+    dstruct::BTree<int> set;
+    dstruct::BTreeMap<int, dstruct::String> map; // see dstruct.hpp
+*/
+
+template <
+    typename T,
+    typename GetKey = BTreeKey<T>,
+    typename CMP = dstruct::less<typename GetKey::KeyType>,
+    typename Alloc = dstruct::Alloc,
+    int NodeBytes = DSTRUCT_CACHE_LINE_SIZE * 4
+>
+class BTree : public DStructTypeSpec<T, Alloc,
+    BTreeIterator_<T, BTreeNodeCap_<T, typename GetKey::KeyType, NodeBytes>::LEAF>,
+    BTreeIterator_<T, BTreeNodeCap_<T, typename GetKey::KeyType, NodeBytes>::LEAF>> {
+
+protected:
+    using Key_ = typename GetKey::KeyType;
+    using NodeCap_ = BTreeNodeCap_<T, Key_, NodeBytes>;
+
+    constexpr static int LEAF_CAP = NodeCap_::LEAF;
+    constexpr static int INNER_CAP = NodeCap_::INNER;
+    constexpr static int LEAF_MIN = LEAF_CAP / 2;
+    constexpr static int INNER_MIN = INNER_CAP / 2;
+    constexpr static int MAX_DEPTH = 48; // inner node has 3+ children, enough for 64-bit size
+
+    using Leaf_ = BTreeLeaf_<T, LEAF_CAP>;
+    using Inner_ = BTreeInner_<Key_, INNER_CAP>;
+    using AllocLeaf_ = AllocSpec<Leaf_, Alloc>;
+    using AllocInner_ = AllocSpec<Inner_, Alloc>;
+
+    // the inner nodes from root to leaf, node->children[index] is the next
+    struct Path_ {
+        Inner_ *node;
+        int index;
+    };
+
+public: // big five
+    BTree(const CMP &cmp = CMP(), const GetKey &getKey = GetKey()) :
+        mCmp_d { cmp }, mGetKey_d { getKey },
+        mRoot_d { nullptr }, mFirst_d { nullptr }, mHeight_d { 0 }, mSize_d { 0 }, mLeafNum_d { 0 } { }
+
+    explicit BTree(Alloc &alloc, const CMP &cmp = CMP(), const GetKey &getKey = GetKey()) :
+        BTree::DStructTypeSpec { alloc }, mCmp_d { cmp }, mGetKey_d { getKey },
+        mRoot_d { nullptr }, mFirst_d { nullptr }, mHeight_d { 0 }, mSize_d { 0 }, mLeafNum_d { 0 } { }
+
+    DSTRUCT_COPY_SEMANTICS(BTree) {
+        clear();
+        BTree::Alloc_::_alloc_inherit(ds);
+
+        mCmp_d = ds.mCmp_d;
+        mGetKey_d = ds.mGetKey_d;
+        for (auto it = ds.begin(); it != ds.end(); it++) {
+            push(*it);
+        }
+
+        return *this;
+    }
+
+    DSTRUCT_MOVE_SEMANTICS(BTree) {
+        clear();
+        BTree::Alloc_::_alloc_take(ds);
+
+        mCmp_d = ds.mCmp_d;
+        mGetKey_d = ds.mGetKey_d;
+        mRoot_d = ds.mRoot_d;
+        mFirst_d = ds.mFirst_d;
+        mHeight_d = ds.mHeight_d;
+        mSize_d = ds.mSize_d;
+        mLeafNum_d = ds.mLeafNum_d;
+
+        ds.mRoot_d = nullptr;
+        ds.mFirst_d = nullptr;
+        ds.mHeight_d = 0;
+        ds.mSize_d = ds.mLeafNum_d = 0;
+
+        return *this;
+    }
+
+    ~BTree() {
+        clear();
+    }
+
+public: // Capacity
+    bool empty() const {
+        return mSize_d == 0;
+    }
+
+    typename BTree::SizeType size() const {
+        return mSize_d;
+    }
+
+    // objs the allocated leaves can hold
+    typename BTree::SizeType capacity() const {
+        return mLeafNum_d * LEAF_CAP;
+    }
+
+    // levels of nodes, 1: root is a leaf
+    int height() const {
+        return mHeight_d;
+    }
+
+public: // Modifiers
+    // insert if not exist
+    void push(const T &obj) {
+        bool inserted;
+        _find_or_insert(mGetKey_d(obj), [&obj](T *addr) {
+            dstruct::construct(addr, obj);
+        }, inserted);
+    }
+
+    void push(T &&obj) {
+        bool inserted;
+        _find_or_insert(mGetKey_d(obj), [&obj](T *addr) {
+            dstruct::construct(addr, dstruct::move(obj));
+        }, inserted);
+    }
+
+    void pop(const T &obj) {
+        _pop_by_key(mGetKey_d(obj));
+    }
+
+    typename BTree::ConstIteratorType erase(typename BTree::ConstIteratorType it) {
+        Key_ key(mGetKey_d(*it));
+        _erase(key);
+        // leaves may be merged, locate the next by key
+        return _lower_bound(key);
+    }
+
+    void clear() {
+        if (mRoot_d != nullptr) _destroy_node(mRoot_d, 1);
+        mRoot_d = nullptr;
+        mFirst_d = nullptr;
+        mHeight_d = 0;
+        mSize_d = mLeafNum_d = 0;
+    }
+
+public: // Lookup
+    typename BTree::ConstIteratorType find(const T &obj) const {
+        return _find_by_key(mGetKey_d(obj));
+    }
+
+    bool contains(const T &obj) const {
+        return find(obj) != end();
+    }
+
+    // the first obj not less than obj
+    typename BTree::ConstIteratorType lower_bound(const T &obj) const {
+        return _lower_bound(mGetKey_d(obj));
+    }
+
+public: // range-for and iterator
+    typename BTree::ConstIteratorType begin() const {
+        return typename BTree::ConstIteratorType(mFirst_d, 0);
+    }
+
+    typename BTree::ConstIteratorType end() const {
+        return typename BTree::ConstIteratorType();
+    }
+
+public: // for Map
+    // one descent: return the obj equal to key, or create one by make(T *addr) in the leaf
+    template <typename K, typename Make>
+    typename BTree::ConstIteratorType
+    _find_or_insert(const K &key, const Make &make, bool &inserted) {
+        if (mRoot_d == nullptr) {
+            mRoot_d = mFirst_d = _create_leaf();
+            mHeight_d = 1;
+        }
+
+        Path_ path[MAX_DEPTH];
+        Leaf_ *leaf = _descend(key, path);
+        int pos = _leaf_lower_bound(leaf, key);
+        if (pos < leaf->count && !mCmp_d(key, mGetKey_d(leaf->slots()[pos]))) {
+            inserted = false;
+            return typename BTree::ConstIteratorType(leaf, pos);
+        }
+
+        if (leaf->count == LEAF_CAP) {
+            Leaf_ *right = _split_leaf(leaf, path);
+            if (pos > leaf->count) {
+                pos -= leaf->count;
+                leaf = right;
+            }
+        }
+
+        _relocate(leaf->slots() + pos + 1, leaf->slots() + pos, leaf->count - pos);
+        make(leaf->slots() + pos);
+        leaf->count++;
+        mSize_d++;
+
+        inserted = true;
+        return typename BTree::ConstIteratorType(leaf, pos);
+    }
+
+    // lookup/remove by key, no T is built for the compare
+    template <typename K>
+    typename BTree::ConstIteratorType _find_by_key(const K &key) const {
+        auto it = _lower_bound(key);
+        if (it != end() && !mCmp_d(key, mGetKey_d(*it))) return it;
+        return end();
+    }
+
+    template <typename K>
+    void _pop_by_key(const K &key) {
+        _erase(key);
+    }
+
+protected:
+    CMP mCmp_d;
+    GetKey mGetKey_d;
+    void *mRoot_d;      // Leaf_ if mHeight_d == 1, otherwise Inner_
+    Leaf_ *mFirst_d;    // head of the leaf list
+    int mHeight_d;
+    typename BTree::SizeType mSize_d;
+    typename BTree::SizeType mLeafNum_d;
+
+    // move n objs from src to raw memory dst(overlap is fine), src become raw memory
+    template <typename U>
+    static void _relocate(U *dst, U *src, int n) {
+        if (n <= 0 || dst == src) return;
+        if (IsTriviallyRelocatable<U>::value) {
+            dstruct::mem_move(dst, src, n * sizeof(U));
+        } else if (dst < src) {
+            for (int i = 0; i < n; i++) {
+                dstruct::construct(dst + i, dstruct::move(src[i]));
+                dstruct::destroy(src + i);
+            }
+        } else {
+            for (int i = n - 1; i >= 0; i--) {
+                dstruct::construct(dst + i, dstruct::move(src[i]));
+                dstruct::destroy(src + i);
+            }
+        }
+    }
+
+    static void _move_children(void **dst, void **src, int n) {
+        if (n > 0) dstruct::mem_move(dst, src, n * sizeof(void *));
+    }
+
+    // first i: !(slots[i] < key)
+    template <typename K>
+    int _leaf_lower_bound(const Leaf_ *leaf, const K &key) const {
+        int first = 0, last = leaf->count;
+        while (first < last) {
+            int mid = (first + last) / 2;
+            if (mCmp_d(mGetKey_d(leaf->slots()[mid]), key)) first = mid + 1;
+            else last = mid;
+        }
+        return first;
+    }
+
+    // first i: key < keys[i], the child index
+    template <typename K>
+    int _inner_upper_bound(const Inner_ *inner, const K &key) const {
+        int first = 0, last = inner->count;
+        while (first < last) {
+            int mid = (first + last) / 2;
+            if (mCmp_d(key, inner->keys()[mid])) last = mid;
+            else first = mid + 1;
+        }
+        return first;
+    }
+
+    // path: inner nodes of levels [1, mHeight_d), nullptr if not needed
+    template <typename K>
+    Leaf_ * _descend(const K &key, Path_ *path) const {
+        void *node = mRoot_d;
+        for (int depth = 0; depth < mHeight_d - 1; depth++) {
+            Inner_ *inner = static_cast<Inner_ *>(node);
+            int index = _inner_upper_bound(inner, key);
+            if (path) path[depth] = { inner, index };
+            node = inner->children[index];
+        }
+        return static_cast<Leaf_ *>(node);
+    }
+
+    template <typename K>
+    typename BTree::ConstIteratorType _lower_bound(const K &key) const {
+        if (mRoot_d == nullptr) return end();
+        Leaf_ *leaf = _descend(key, nullptr);
+        int pos = _leaf_lower_bound(leaf, key);
+        if (pos == leaf->count) { // all less than key, the next leaf
+            leaf = leaf->next;
+            pos = 0;
+        }
+        return typename BTree::ConstIteratorType(leaf, pos);
+    }
+
+    Leaf_ * _create_leaf() {
+        Leaf_ *leaf = AllocLeaf_(*this).allocate();
+        DSTRUCT_ASSERT(leaf != nullptr);
+        leaf->count = 0;
+        leaf->prev = leaf->next = nullptr;
+        mLeafNum_d++;
+        return leaf;
+    }
+
+    void _free_leaf(Leaf_ *leaf) {
+        AllocLeaf_(*this).deallocate(leaf);
+        mLeafNum_d--;
+    }
+
+    Inner_ * _create_inner() {
+        Inner_ *inner = AllocInner_(*this).allocate();
+        DSTRUCT_ASSERT(inner != nullptr);
+        inner->count = 0;
+        return inner;
+    }
+
+    void _free_inner(Inner_ *inner) {
+        AllocInner_(*this).deallocate(inner);
+    }
+
+    void _destroy_node(void *node, int level) {
+        if (level == mHeight_d) {
+            Leaf_ *leaf = static_cast<Leaf_ *>(node);
+            for (int i = 0; i < leaf->count; i++) dstruct::destroy(leaf->slots() + i);
+            _free_leaf(leaf);
+        } else {
+            Inner_ *inner = static_cast<Inner_ *>(node);
+            for (int i = 0; i <= inner->count; i++) _destroy_node(inner->children[i], level + 1);
+            for (int i = 0; i < inner->count; i++) dstruct::destroy(inner->keys() + i);
+            _free_inner(inner);
+        }
+    }
+
+    // full leaf -> [0, half) + [half, LEAF_CAP), return the right one
+    Leaf_ * _split_leaf(Leaf_ *leaf, Path_ *path) {
+        Leaf_ *right = _create_leaf();
+        int half = LEAF_CAP / 2;
+        _relocate(right->slots(), leaf->slots() + half, LEAF_CAP - half);
+        right->count = LEAF_CAP - half;
+        leaf->count = half;
+
+        right->prev = leaf;
+        right->next = leaf->next;
+        if (leaf->next) leaf->next->prev = right;
+        leaf->next = right;
+
+        _insert_separator(path, mHeight_d - 1, Key_(mGetKey_d(right->slots()[0])), right);
+        return right;
+    }
+
+    // put key/right at keys[index]/children[index + 1], inner isn't full
+    static void _inner_insert(Inner_ *inner, int index, Key_ &&key, void *right) {
+        _relocate(inner->keys() + index + 1, inner->keys() + index, inner->count - index);
+        _move_children(inner->children + index + 2, inner->children + index + 1, inner->count - index);
+        dstruct::construct(inner->keys() + index, dstruct::move(key));
+        inner->children[index + 1] = right;
+        inner->count++;
+    }
+
+    // remove keys[index] and children[index + 1]
+    static void _inner_remove(Inner_ *inner, int index) {
+        dstruct::destroy(inner->keys() + index);
+        _relocate(inner->keys() + index, inner->keys() + index + 1, inner->count - index - 1);
+        _move_children(inner->children + index + 1, inner->children + index + 2, inner->count - index - 1);
+        inner->count--;
+    }
+
+    // node path[depth - 1].node->children[index] was split, right is the new sibling after it
+    void _insert_separator(Path_ *path, int depth, Key_ &&separator, void *right) {
+        Key_ key(dstruct::move(separator));
+        while (depth > 0) {
+            Inner_ *inner = path[depth - 1].node;
+            int index = path[depth - 1].index;
+            if (inner->count < INNER_CAP) {
+                _inner_insert(inner, index, dstruct::move(key), right);
+                return;
+            }
+
+            // full inner + key -> INNER_CAP + 1 keys, the middle one(index half) is promoted
+            // both halves get at least INNER_MIN keys
+            Inner_ *rightInner = _create_inner();
+            int half = INNER_CAP / 2;
+            if (index == half) { // key itself is promoted
+                rightInner->count = INNER_CAP - half;
+                _relocate(rightInner->keys(), inner->keys() + half, rightInner->count);
+                _move_children(rightInner->children + 1, inner->children + half + 1, rightInner->count);
+                rightInner->children[0] = right;
+                inner->count = half;
+            } else {
+                // keys [0, mid) + promoted keys[mid] + [mid + 1, INNER_CAP), key goes to one side
+                int mid = index < half ? half - 1 : half;
+                rightInner->count = INNER_CAP - mid - 1;
+                _relocate(rightInner->keys(), inner->keys() + mid + 1, rightInner->count);
+                _move_children(rightInner->children, inner->children + mid + 1, rightInner->count + 1);
+                Key_ promoted(dstruct::move(inner->keys()[mid]));
+                dstruct::destroy(inner->keys() + mid);
+                inner->count = mid;
+
+                if (index < half) _inner_insert(inner, index, dstruct::move(key), right);
+                else _inner_insert(rightInner, index - mid - 1, dstruct::move(key), right);
+                key = dstruct::move(promoted);
+            }
+
+            right = rightInner;
+            depth--;
+        }
+
+        // root was split
+        Inner_ *root = _create_inner();
+        root->children[0] = mRoot_d;
+        _inner_insert(root, 0, dstruct::move(key), right);
+        mRoot_d = root;
+        mHeight_d++;
+    }
+
+    template <typename K>
+    bool _erase(const K &key) {
+        if (mRoot_d == nullptr) return false;
+
+        Path_ path[MAX_DEPTH];
+        Leaf_ *leaf = _descend(key, path);
+        int pos = _leaf_lower_bound(leaf, key);
+        if (pos == leaf->count || mCmp_d(key, mGetKey_d(leaf->slots()[pos]))) return false;
+
+        dstruct::destroy(leaf->slots() + pos);
+        _relocate(leaf->slots() + pos, leaf->slots() + pos + 1, leaf->count - pos - 1);
+        leaf->count--;
+        mSize_d--;
+
+        _rebalance_leaf(leaf, path);
+        return true;
+    }
+
+    void _rebalance_leaf(Leaf_ *leaf, Path_ *path) {
+        int depth = mHeight_d - 1;
+        if (depth == 0) { // root
+            if (leaf->count == 0) clear();
+            return;
+        }
+        if (leaf->count >= LEAF_MIN) return;
+
+        Inner_ *parent = path[depth - 1].node;
+        int index = path[depth - 1].index;
+        Leaf_ *left = index > 0 ? static_cast<Leaf_ *>(parent->children[index - 1]) : nullptr;
+        Leaf_ *right = index < parent->count ? static_cast<Leaf_ *>(parent->children[index + 1]) : nullptr;
+
+        if (left && left->count > LEAF_MIN) { // borrow the last of left
+            _relocate(leaf->slots() + 1, leaf->slots(), leaf->count);
+            _relocate(leaf->slots(), left->slots() + left->count - 1, 1);
+            left->count--;
+            leaf->count++;
+            parent->keys()[index - 1] = mGetKey_d(leaf->slots()[0]);
+        } else if (right && right->count > LEAF_MIN) { // borrow the first of right
+            _relocate(leaf->slots() + leaf->count, right->slots(), 1);
+            _relocate(right->slots(), right->slots() + 1, right->count - 1);
+            right->count--;
+            leaf->count++;
+            parent->keys()[index] = mGetKey_d(right->slots()[0]);
+        } else {
+            if (left) { // merge to left
+                _merge_leaf(left, leaf);
+                _inner_remove(parent, index - 1);
+            } else {
+                _merge_leaf(leaf, right);
+                _inner_remove(parent, index);
+            }
+            _rebalance_inner(path, depth - 1);
+        }
+    }
+
+    // src is appended to dst and freed
+    void _merge_leaf(Leaf_ *dst, Leaf_ *src) {
+        _relocate(dst->slots() + dst->count, src->slots(), src->count);
+        dst->count += src->count;
+        dst->next = src->next;
+        if (src->next) src->next->prev = dst;
+        _free_leaf(src);
+    }
+
+    // path[depth].node lost a key
+    void _rebalance_inner(Path_ *path, int depth) {
+        while (true) {
+            Inner_ *inner = path[depth].node;
+            if (depth == 0) { // root
+                if (inner->count == 0) {
+                    mRoot_d = inner->children[0];
+                    _free_inner(inner);
+                    mHeight_d--;
+                }
+                return;
+            }
+            if (inner->count >= INNER_MIN) return;
+
+            Inner_ *parent = path[depth - 1].node;
+            int index = path[depth - 1].index;
+            Inner_ *left = index > 0 ? static_cast<Inner_ *>(parent->children[index - 1]) : nullptr;
+            Inner_ *right = index < parent->count ? static_cast<Inner_ *>(parent->children[index + 1]) : nullptr;
+
+            if (left && left->count > INNER_MIN) { // rotate right through parent
+                _relocate(inner->keys() + 1, inner->keys(), inner->count);
+                _move_children(inner->children + 1, inner->children, inner->count + 1);
+                dstruct::construct(inner->keys(), dstruct::move(parent->keys()[index - 1]));
+                inner->children[0] = left->children[left->count];
+                inner->count++;
+                parent->keys()[index - 1] = dstruct::move(left->keys()[left->count - 1]);
+                dstruct::destroy(left->keys() + left->count - 1);
+                left->count--;
+                return;
+            } else if (right && right->count > INNER_MIN) { // rotate left through parent
+                dstruct::construct(inner->keys() + inner->count, dstruct::move(parent->keys()[index]));
+                inner->children[inner->count + 1] = right->children[0];
+                inner->count++;
+                parent->keys()[index] = dstruct::move(right->keys()[0]);
+                dstruct::destroy(right->keys());
+                _relocate(right->keys(), right->keys() + 1, right->count - 1);
+                _move_children(right->children, right->children + 1, right->count);
+                right->count--;
+                return;
+            }
+
+            if (left) {
+                _merge_inner(left, inner, parent->keys()[index - 1]);
+                _inner_remove(parent, index - 1);
+            } else {
+                _merge_inner(inner, right, parent->keys()[index]);
+                _inner_remove(parent, index);
+            }
+            depth--;
+        }
+    }
+
+    // dst + separator + src, src is freed
+    void _merge_inner(Inner_ *dst, Inner_ *src, Key_ &separator) {
+        dstruct::construct(dst->keys() + dst->count, dstruct::move(separator));
+        _relocate(dst->keys() + dst->count + 1, src->keys(), src->count);
+        _move_children(dst->children + dst->count + 1, src->children, src->count + 1);
+        dst->count += src->count + 1;
+        _free_inner(src);
+    }
+};
+
+}
+
+#endif
@@ -31,6 +31,8 @@ protected:
 public: // big five
 
     BinarySearchTree(CMP cmp = CMP()) : BinaryTree_e { nullptr, 0 }, mCmp_d { cmp } { }
+    explicit BinarySearchTree(Alloc &alloc, CMP cmp = CMP()) :
+        BinaryTree_e { nullptr, 0, alloc }, mCmp_d { cmp } { }
 
     BinarySearchTree(const PrimitiveIterator<T> &begin, const PrimitiveIterator<T> &end, CMP cmp = CMP()) :
         BinarySearchTree(cmp) {
@@ -41,6 +43,7 @@ public: // big five
 
     DSTRUCT_COPY_SEMANTICS(BinarySearchTree) {
         BinaryTree_e::clear();
+        BinarySearchTree::Alloc_::_alloc_inherit(ds);
         BinaryTree_e::mRootPtr_d = BinaryTree_e::copy(ds.mRootPtr_d);
         BinaryTree_e::mSize_d = ds.mSize_d;
         mCmp_d = ds.mCmp_d;
@@ -49,6 +52,7 @@ public: // big five
 
     DSTRUCT_MOVE_SEMANTICS(BinarySearchTree) {
         BinaryTree_e::clear();
+        BinarySearchTree::Alloc_::_alloc_take(ds);
 
         // move
         BinaryTree_e::mRootPtr_d = ds.mRootPtr_d;
@@ -163,7 +167,7 @@ protected:
         }
 
         // create node
-        auto nodePtr = AllocNode_::allocate();
+        auto nodePtr = AllocNode_(*this).allocate();
         auto newNodeLink = Node_::to_link(nodePtr);
         dstruct::construct(nodePtr, Node_(obj));
 
@@ -230,7 +234,7 @@ protected:
         // real delete
         auto nPtr = Node_::to_node(linkPtr);
         dstruct::destroy(nPtr);
-        AllocNode_::deallocate(nPtr);
+        AllocNode_(*this).deallocate(nPtr);
         BinaryTree_e::mSize_d--;
 
         return subTree;
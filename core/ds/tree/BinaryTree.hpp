@@ -110,6 +110,8 @@ protected:
 
 public:
     BinaryTree(Node_ *root, size_t size) : mSize_d { size }, mRootPtr_d { root } { }
+    BinaryTree(Node_ *root, size_t size, Alloc &alloc) :
+        BinaryTree::DStructTypeSpec { alloc }, mSize_d { size }, mRootPtr_d { root } { }
 /*
     DSTRUCT_COPY_SEMANTICS
     DSTRUCT_MOVE_SEMANTICS
@@ -179,11 +181,11 @@ public: // range-for and iterator
     }
 
 public:
-    static Node_ * copy(Node_ *root) {
+    Node_ * copy(Node_ *root) const {
         if (!root)
             return nullptr;
 
-        Node_ *newRoot = AllocNode_::allocate();
+        Node_ *newRoot = AllocNode_(*this).allocate();
         newRoot->data = root->data;
         newRoot->parent = nullptr;
 
@@ -198,12 +200,12 @@ public:
         return newRoot;
     }
 
-    static void clear(Node_ * &root) {
+    void clear(Node_ * &root) const {
         if (root) {
-            tree::postorder_traversal(&(root->link), [](typename Node_::LinkType *linkPtr) {
+            tree::postorder_traversal(&(root->link), [this](typename Node_::LinkType *linkPtr) {
                 Node_ *nPtr = Node_::to_node(linkPtr);
                 dstruct::destroy(nPtr);
-                AllocNode_::deallocate(nPtr);
+                AllocNode_(*this).deallocate(nPtr);
             });
         }
         root = nullptr;
@@ -0,0 +1,514 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef RB_TREE_HPP_DSTRUCT
+#define RB_TREE_HPP_DSTRUCT
+
+#include <core/common.hpp>
+#include <core/ds/tree/tree-base.hpp>
+
+namespace dstruct {
+
+namespace tree {
+// Red-Black Tree Link: BinaryTreeLink_ with color in the lowest bit of parent
+/*
+   Parent | Color(0: red, 1: black)
+    ^
+    |
+  TreeNode
+   / \
+  L   R
+*/
+struct RBTreeLink_ {
+    ptr_t parentColor;
+    RBTreeLink_ *left;
+    RBTreeLink_ *right;
+
+    RBTreeLink_() : parentColor { 0 }, left { nullptr }, right { nullptr } {}
+};
+
+enum RBColor_ : ptr_t {
+    RB_RED = 0,
+    RB_BLACK = 1,
+};
+
+static RBTreeLink_ * rb_parent(const RBTreeLink_ *link) {
+    return reinterpret_cast<RBTreeLink_ *>(link->parentColor & ~static_cast<ptr_t>(1));
+}
+
+// nullptr is black
+static bool rb_is_red(const RBTreeLink_ *link) {
+    return link != nullptr && (link->parentColor & 1) == RB_RED;
+}
+
+static void rb_set_parent(RBTreeLink_ *link, RBTreeLink_ *parent) {
+    link->parentColor = reinterpret_cast<ptr_t>(parent) | (link->parentColor & 1);
+}
+
+static void rb_set_color(RBTreeLink_ *link, ptr_t color) {
+    link->parentColor = (link->parentColor & ~static_cast<ptr_t>(1)) | color;
+}
+
+static RBTreeLink_ * rb_first(RBTreeLink_ *root) {
+    if (root == nullptr) return nullptr;
+    while (root->left != nullptr) root = root->left;
+    return root;
+}
+
+static RBTreeLink_ * rb_next(RBTreeLink_ *link) {
+    if (link->right != nullptr) return rb_first(link->right);
+
+    RBTreeLink_ *parent = rb_parent(link);
+    while (parent != nullptr && parent->right == link) {
+        link = parent;
+        parent = rb_parent(link);
+    }
+    return parent;
+}
+
+static int rb_height(const RBTreeLink_ *root) {
+    if (root == nullptr) return 0;
+    int lH = rb_height(root->left), rH = rb_height(root->right);
+    return (lH > rH ? lH : rH) + 1;
+}
+
+template <typename T>
+using RBTreeNode = TreeNode<T, RBTreeLink_>;
+
+} // namespace tree
+
+template <typename T>
+class RBTreeIterator_ : public DStructIteratorTypeSpec<const T> {
+private:
+    using Self = RBTreeIterator_;
+    using Node_ = tree::RBTreeNode<T>;
+public:
+    RBTreeIterator_(tree::RBTreeLink_ *link = nullptr) : mLink_d { link } {
+        _sync();
+    }
+
+public: // ForwardIterator
+    Self& operator++() {
+        mLink_d = tree::rb_next(mLink_d);
+        _sync();
+        return *this;
+    }
+
+    Self operator++(int) {
+        Self old = *this;
+        ++(*this);
+        return old;
+    }
+
+public:
+    tree::RBTreeLink_ * _get_link_pointer() const {
+        return mLink_d;
+    }
+
+private:
+    void _sync() {
+        Self::mPointer_d = mLink_d ? &(Node_::to_node(mLink_d)->data) : nullptr;
+    }
+
+    tree::RBTreeLink_ *mLink_d;
+};
+
+/*
+RBTree: red-black tree, iterative insert/erase
+
+    1. node is red or black, root is black
+    2. no red node has a red child
+    3. every path from a node to nullptr has the same number of black nodes
+       -> height <= 2 * log2(n + 1)
+
+    push: attach a red leaf, fix red-red upward by recoloring(no rotation), stop with at most 2 rotations
+    pop:  unlink the node(or swap with its successor by relink, the obj isn't moved),
+          fix a missing black upward by recoloring, stop with at most 3 rotations
+          -> O(1) amortized rotations/writes per push/pop, no height field to update
+
+    color is packed in parent pointer(nodes are aligned), node size is same as BinaryTree's
+
+Note:
+    iterator is only invalidated by erasing its node, erase return the next iterator
+    T's key must not be modified by iterator(const)
+usage:
+    dstruct::RBTree<int, dstruct::less<int>, dstruct::Alloc> tree;
+    dstruct::RBTreeMap<int, Order> book; // see dstruct.hpp
+*/
+
+template <typename T, typename CMP = dstruct::less<T>, typename Alloc = dstruct::Alloc>
+class RBTree : public DStructTypeSpec<T, Alloc, RBTreeIterator_<T>, RBTreeIterator_<T>> {
+
+protected:
+    using Link_ = tree::RBTreeLink_;
+    using Node_ = tree::RBTreeNode<T>;
+    using AllocNode_ = AllocSpec<Node_, Alloc>;
+
+    static_assert(alignof(Node_) >= 2, "no free bit in parent pointer for color");
+
+public: // big five
+    RBTree(CMP cmp = CMP()) : mCmp_d { cmp }, mRoot_d { nullptr }, mSize_d { 0 } { }
+
+    explicit RBTree(Alloc &alloc, CMP cmp = CMP()) :
+        RBTree::DStructTypeSpec { alloc }, mCmp_d { cmp }, mRoot_d { nullptr }, mSize_d { 0 } { }
+
+    DSTRUCT_COPY_SEMANTICS(RBTree) {
+        clear();
+        RBTree::Alloc_::_alloc_inherit(ds);
+
+        mCmp_d = ds.mCmp_d;
+        for (auto it = ds.begin(); it != ds.end(); it++) {
+            push(*it);
+        }
+
+        return *this;
+    }
+
+    DSTRUCT_MOVE_SEMANTICS(RBTree) {
+        clear();
+        RBTree::Alloc_::_alloc_take(ds);
+
+        mCmp_d = ds.mCmp_d;
+        mRoot_d = ds.mRoot_d;
+        mSize_d = ds.mSize_d;
+
+        ds.mRoot_d = nullptr;
+        ds.mSize_d = 0;
+
+        return *this;
+    }
+
+    ~RBTree() {
+        clear();
+    }
+
+public: // Capacity
+    bool empty() const {
+        return mSize_d == 0;
+    }
+
+    typename RBTree::SizeType size() const {
+        return mSize_d;
+    }
+
+    typename RBTree::SizeType capacity() const {
+        return mSize_d;
+    }
+
+    // O(n), walk all nodes
+    int height() const {
+        return tree::rb_height(mRoot_d);
+    }
+
+public: // Modifiers
+    // insert if not exist
+    void push(const T &obj) {
+        bool inserted;
+        _find_or_insert(obj, [&obj](T *addr) {
+            dstruct::construct(addr, obj);
+        }, inserted);
+    }
+
+    void push(T &&obj) {
+        bool inserted;
+        _find_or_insert(obj, [&obj](T *addr) {
+            dstruct::construct(addr, dstruct::move(obj));
+        }, inserted);
+    }
+
+    void pop(const T &obj) {
+        _pop_by_key(obj);
+    }
+
+    // nodes are relinked not copied, the next node is still valid
+    typename RBTree::ConstIteratorType erase(typename RBTree::ConstIteratorType it) {
+        Link_ *target = it._get_link_pointer();
+        Link_ *next = tree::rb_next(target);
+        _erase(target);
+        return typename RBTree::ConstIteratorType(next);
+    }
+
+    void clear() {
+        _destroy(mRoot_d);
+        mRoot_d = nullptr;
+        mSize_d = 0;
+    }
+
+public: // Lookup
+    typename RBTree::ConstIteratorType find(const T &obj) const {
+        return typename RBTree::ConstIteratorType(_find(obj));
+    }
+
+    bool contains(const T &obj) const {
+        return _find(obj) != nullptr;
+    }
+
+public: // range-for and iterator
+    typename RBTree::ConstIteratorType begin() const {
+        return typename RBTree::ConstIteratorType(tree::rb_first(mRoot_d));
+    }
+
+    typename RBTree::ConstIteratorType end() const {
+        return typename RBTree::ConstIteratorType();
+    }
+
+public: // for Map
+    // one descent: return the obj equal to key, or create one by make(T *addr) at the leaf
+    // key: T, or a type CMP can compare with T(e.g. the key of KeyValue)
+    template <typename K, typename Make>
+    typename RBTree::ConstIteratorType
+    _find_or_insert(const K &key, const Make &make, bool &inserted) {
+        Link_ *parent = nullptr;
+        Link_ **childPtr = &mRoot_d;
+        while (*childPtr != nullptr) {
+            parent = *childPtr;
+            const T &val = Node_::to_node(parent)->data;
+            if (mCmp_d(key, val)) {
+                childPtr = &(parent->left);
+            } else if (mCmp_d(val, key)) {
+                childPtr = &(parent->right);
+            } else {
+                inserted = false;
+                return typename RBTree::ConstIteratorType(parent);
+            }
+        }
+
+        Node_ *node = AllocNode_(*this).allocate();
+        DSTRUCT_ASSERT(node != nullptr);
+        dstruct::construct(&(node->link), Link_());
+        make(&(node->data));
+
+        Link_ *link = Node_::to_link(node);
+        link->parentColor = reinterpret_cast<ptr_t>(parent) | tree::RB_RED;
+        *childPtr = link;
+        _insert_fixup(link);
+        mSize_d++;
+
+        inserted = true;
+        return typename RBTree::ConstIteratorType(link);
+    }
+
+    // lookup/remove by key, no T is built for the compare
+    template <typename K>
+    typename RBTree::ConstIteratorType _find_by_key(const K &key) const {
+        return typename RBTree::ConstIteratorType(_find(key));
+    }
+
+    template <typename K>
+    void _pop_by_key(const K &key) {
+        Link_ *target = _find(key);
+        if (target != nullptr) _erase(target);
+    }
+
+    Link_ * _get_root_ptr() const {
+        return mRoot_d;
+    }
+
+protected:
+    CMP mCmp_d;
+    Link_ *mRoot_d;
+    typename RBTree::SizeType mSize_d;
+
+    template <typename K>
+    Link_ * _find(const K &obj) const {
+        Link_ *curr = mRoot_d;
+        while (curr != nullptr) {
+            const T &val = Node_::to_node(curr)->data;
+            if (mCmp_d(obj, val)) curr = curr->left;
+            else if (mCmp_d(val, obj)) curr = curr->right;
+            else break;
+        }
+        return curr;
+    }
+
+    void _destroy(Link_ *root) {
+        if (root == nullptr) return;
+        _destroy(root->left);
+        _destroy(root->right);
+        Node_ *node = Node_::to_node(root);
+        dstruct::destroy(node);
+        AllocNode_(*this).deallocate(node);
+    }
+
+    // oldChild's parent points to newChild
+    void _replace_child(Link_ *parent, Link_ *oldChild, Link_ *newChild) {
+        if (parent == nullptr) mRoot_d = newChild;
+        else if (parent->left == oldChild) parent->left = newChild;
+        else parent->right = newChild;
+    }
+
+    void _rotate_left(Link_ *root) {
+        Link_ *newRoot = root->right;
+        Link_ *parent = tree::rb_parent(root);
+
+        root->right = newRoot->left;
+        if (newRoot->left != nullptr) tree::rb_set_parent(newRoot->left, root);
+
+        newRoot->left = root;
+        tree::rb_set_parent(root, newRoot);
+        tree::rb_set_parent(newRoot, parent);
+        _replace_child(parent, root, newRoot);
+    }
+
+    void _rotate_right(Link_ *root) {
+        Link_ *newRoot = root->left;
+        Link_ *parent = tree::rb_parent(root);
+
+        root->left = newRoot->right;
+        if (newRoot->right != nullptr) tree::rb_set_parent(newRoot->right, root);
+
+        newRoot->right = root;
+        tree::rb_set_parent(root, newRoot);
+        tree::rb_set_parent(newRoot, parent);
+        _replace_child(parent, root, newRoot);
+    }
+
+    // link is red, fix red parent
+    void _insert_fixup(Link_ *link) {
+        Link_ *parent;
+        while ((parent = tree::rb_parent(link)) != nullptr && tree::rb_is_red(parent)) {
+            Link_ *grandparent = tree::rb_parent(parent); // red parent isn't root
+            if (parent == grandparent->left) {
+                Link_ *uncle = grandparent->right;
+                if (tree::rb_is_red(uncle)) { // recolor, continue from grandparent
+                    tree::rb_set_color(parent, tree::RB_BLACK);
+                    tree::rb_set_color(uncle, tree::RB_BLACK);
+                    tree::rb_set_color(grandparent, tree::RB_RED);
+                    link = grandparent;
+                    continue;
+                }
+                if (link == parent->right) { // LR -> LL
+                    _rotate_left(parent);
+                    parent = link;
+                }
+                tree::rb_set_color(parent, tree::RB_BLACK);
+                tree::rb_set_color(grandparent, tree::RB_RED);
+                _rotate_right(grandparent);
+            } else {
+                Link_ *uncle = grandparent->left;
+                if (tree::rb_is_red(uncle)) {
+                    tree::rb_set_color(parent, tree::RB_BLACK);
+                    tree::rb_set_color(uncle, tree::RB_BLACK);
+                    tree::rb_set_color(grandparent, tree::RB_RED);
+                    link = grandparent;
+                    continue;
+                }
+                if (link == parent->left) { // RL -> RR
+                    _rotate_right(parent);
+                    parent = link;
+                }
+                tree::rb_set_color(parent, tree::RB_BLACK);
+                tree::rb_set_color(grandparent, tree::RB_RED);
+                _rotate_left(grandparent);
+            }
+            break;
+        }
+        tree::rb_set_color(mRoot_d, tree::RB_BLACK);
+    }
+
+    void _erase(Link_ *target) {
+        Link_ *child, *parent; // child: takes the removed position, maybe nullptr
+        ptr_t removedColor;
+
+        if (target->left == nullptr || target->right == nullptr) {
+            child = target->left ? target->left : target->right;
+            parent = tree::rb_parent(target);
+            removedColor = target->parentColor & 1;
+            _replace_child(parent, target, child);
+            if (child != nullptr) tree::rb_set_parent(child, parent);
+        } else {
+            // relink the successor to target's position
+            Link_ *successor = tree::rb_first(target->right);
+            removedColor = successor->parentColor & 1;
+            child = successor->right;
+            if (tree::rb_parent(successor) == target) {
+                parent = successor;
+            } else {
+                parent = tree::rb_parent(successor);
+                parent->left = child;
+                if (child != nullptr) tree::rb_set_parent(child, parent);
+                successor->right = target->right;
+                tree::rb_set_parent(target->right, successor);
+            }
+            successor->left = target->left;
+            tree::rb_set_parent(target->left, successor);
+            _replace_child(tree::rb_parent(target), target, successor);
+            successor->parentColor = target->parentColor; // same parent and color
+        }
+
+        Node_ *node = Node_::to_node(target);
+        dstruct::destroy(node);
+        AllocNode_(*this).deallocate(node);
+        mSize_d--;
+
+        if (removedColor == tree::RB_BLACK) _erase_fixup(child, parent);
+    }
+
+    // the path through link lost a black node
+    void _erase_fixup(Link_ *link, Link_ *parent) {
+        while (link != mRoot_d && !tree::rb_is_red(link)) {
+            if (link == parent->left) {
+                Link_ *sibling = parent->right; // not nullptr, has black height >= 1
+                if (tree::rb_is_red(sibling)) {
+                    tree::rb_set_color(sibling, tree::RB_BLACK);
+                    tree::rb_set_color(parent, tree::RB_RED);
+                    _rotate_left(parent);
+                    sibling = parent->right;
+                }
+                if (!tree::rb_is_red(sibling->left) && !tree::rb_is_red(sibling->right)) {
+                    tree::rb_set_color(sibling, tree::RB_RED); // recolor, continue from parent
+                    link = parent;
+                    parent = tree::rb_parent(link);
+                    continue;
+                }
+                if (!tree::rb_is_red(sibling->right)) {
+                    tree::rb_set_color(sibling->left, tree::RB_BLACK);
+                    tree::rb_set_color(sibling, tree::RB_RED);
+                    _rotate_right(sibling);
+                    sibling = parent->right;
+                }
+                tree::rb_set_color(sibling, parent->parentColor & 1);
+                tree::rb_set_color(parent, tree::RB_BLACK);
+                tree::rb_set_color(sibling->right, tree::RB_BLACK);
+                _rotate_left(parent);
+            } else {
+                Link_ *sibling = parent->left;
+                if (tree::rb_is_red(sibling)) {
+                    tree::rb_set_color(sibling, tree::RB_BLACK);
+                    tree::rb_set_color(parent, tree::RB_RED);
+                    _rotate_right(parent);
+                    sibling = parent->left;
+                }
+                if (!tree::rb_is_red(sibling->left) && !tree::rb_is_red(sibling->right)) {
+                    tree::rb_set_color(sibling, tree::RB_RED);
+                    link = parent;
+                    parent = tree::rb_parent(link);
+                    continue;
+                }
+                if (!tree::rb_is_red(sibling->left)) {
+                    tree::rb_set_color(sibling->right, tree::RB_BLACK);
+                    tree::rb_set_color(sibling, tree::RB_RED);
+                    _rotate_left(sibling);
+                    sibling = parent->left;
+                }
+                tree::rb_set_color(sibling, parent->parentColor & 1);
+                tree::rb_set_color(parent, tree::RB_BLACK);
+                tree::rb_set_color(sibling->left, tree::RB_BLACK);
+                _rotate_right(parent);
+            }
+            link = mRoot_d;
+            break;
+        }
+        if (link != nullptr) tree::rb_set_color(link, tree::RB_BLACK);
+    }
+};
+
+}
+
+#endif
@@ -48,6 +48,22 @@ struct IsPointer<T *> {
     const static bool value = true;
 };
 
+template <typename T>
+struct IsTriviallyCopyable {
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+    const static bool value = __is_trivially_copyable(T);
+#else
+    const static bool value = false;
+#endif
+};
+
+// relocate: move to new address and destroy the old, by memcpy.
+// specialize it for type without self-reference, e.g. dstruct::Vector
+template <typename T>
+struct IsTriviallyRelocatable {
+    const static bool value = IsTriviallyCopyable<T>::value;
+};
+
 template <typename T>
 struct less {
     bool operator()(const T& a, const T& b) const {
@@ -80,6 +96,13 @@ struct greater<T *> {
     }
 };
 
+template <typename T>
+struct equal_to {
+    bool operator()(const T& a, const T& b) const {
+        return a == b;
+    }
+};
+
 template <typename T>
 static typename RemoveReference<T>::Type&& move(T&& arg) noexcept {
     return static_cast<typename RemoveReference<T>::Type&&>(arg);
@@ -103,6 +126,11 @@ static void swap(T &a, T &b) {
     b = dstruct::move(c);
 }
 
+template<typename T>
+static constexpr T&& forward(typename RemoveReference<T>::Type& arg) noexcept {
+    return static_cast<T&&>(arg);
+}
+
 template <typename T>
 static T max(const T &a, const T &b) {
     return a > b ? a : b;
@@ -113,6 +141,54 @@ static T abs(const T &a) {
     return a >= 0 ? a : -a;
 }
 
+static void * mem_copy(void *dst, const void *src, unsigned long long bytes) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_memcpy(dst, src, bytes);
+#else
+    char *d = static_cast<char *>(dst);
+    const char *s = static_cast<const char *>(src);
+    while (bytes--) *d++ = *s++;
+    return dst;
+#endif
+}
+
+// [dst, dst + bytes) may overlap [src, src + bytes)
+static void * mem_move(void *dst, const void *src, unsigned long long bytes) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_memmove(dst, src, bytes);
+#else
+    char *d = static_cast<char *>(dst);
+    const char *s = static_cast<const char *>(src);
+    if (d < s) {
+        while (bytes--) *d++ = *s++;
+    } else {
+        while (bytes--) d[bytes] = s[bytes];
+    }
+    return dst;
+#endif
+}
+
+// bit op - request: x != 0
+static int count_trailing_zeros(unsigned long long x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#else
+    int n = 0;
+    while ((x & 1) == 0) { x >>= 1; n++; }
+    return n;
+#endif
+}
+
+static int floor_log2(unsigned long long x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(x);
+#else
+    int n = -1;
+    while (x) { x >>= 1; n++; }
+    return n;
+#endif
+}
+
 };
 
 #endif
\ No newline at end of file
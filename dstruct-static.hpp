@@ -11,10 +11,14 @@
 #define DSTRUCT_STATIC_HPP_DSTRUCT
 
 #include <core/ds/Heap.hpp>
+#include <core/ds/IndexedHeap.hpp>
+#include <core/ds/PairingHeap.hpp>
+#include <core/ds/RadixHeap.hpp>
 
 // Array
 #include <core/ds/array/Array.hpp>
 #include <core/ds/array/Vector.hpp>
+#include <core/ds/array/SmallVector.hpp>
 
 // stack
 #include <core/ds/stack/Stack.hpp>
@@ -41,6 +45,10 @@
 // other
 #include <core/algorithm.hpp>
 #include <memory/StaticMemAllocator.hpp>
+#include <memory/BoundaryTagMemAllocator.hpp>
+#include <memory/MonotonicArena.hpp>
+#include <memory/MonotonicAllocator.hpp>
+#include <memory/PoolAlloc.hpp>
 
 namespace dstruct {
 
@@ -79,6 +87,8 @@ namespace smemory {
     using Deque = DoubleEndedQueue<T, ArrSize, SMA>;
     template <typename T, typename CMP = less<T>>
     using PriorityQueue = Heap<T, CMP, SMA>;
+    template <typename T, typename CMP = less<T>>
+    using IndexedPriorityQueue = IndexedHeap<T, CMP, SMA>;
 
 // Stack
     template <typename T>
@@ -93,6 +103,10 @@ namespace smemory {
     using MinHeap = Heap<T, less<T>, SMA>;
     template <typename T>
     using MaxHeap = Heap<T, greater<T>, SMA>;
+    template <typename T, typename CMP = less<T>>
+    using PairingHeap = dstruct::PairingHeap<T, CMP, SMA>;
+    template <typename T, typename GetKey = RadixHeapKey<T>>
+    using RadixHeap = dstruct::RadixHeap<T, GetKey, SMA>;
 
 // Tree
     template <typename T>
@@ -15,8 +15,12 @@
 #include <dstruct-static.hpp>
 
 #include <core/ds/Heap.hpp>
+#include <core/ds/IndexedHeap.hpp>
+#include <core/ds/PairingHeap.hpp>
+#include <core/ds/RadixHeap.hpp>
 
 #include <core/ds/array/Vector.hpp>
+#include <core/ds/array/SmallVector.hpp>
 
 // static
 #include <core/ds/array/Array.hpp>
@@ -29,6 +33,9 @@
 // queue
 #include <core/ds/queue/Queue.hpp>
 #include <core/ds/queue/DoubleEndedQueue.hpp>
+#include <core/ds/queue/SPSCQueue.hpp>
+#include <core/ds/queue/MPMCQueue.hpp>
+#include <core/ds/queue/WorkStealingDeque.hpp>
 
 // linked list
 #include <core/ds/linked-list/SinglyLinkedList.hpp>
@@ -40,17 +47,26 @@
 // tree
 #include <core/ds/tree/BinarySearchTree.hpp>
 #include <core/ds/tree/AVLTree.hpp>
+#include <core/ds/tree/BTree.hpp>
+#include <core/ds/tree/RBTree.hpp>
 
 // set
 #include <core/ds/set/DisjointSet.hpp>
 
 // map
+#include <core/ds/hash/HashTable.hpp>
 #include <core/ds/Map.hpp>
 
 #include <core/algorithm.hpp>
 
 // other
 #include <memory/StaticMemAllocator.hpp>
+#include <memory/BoundaryTagMemAllocator.hpp>
+#include <memory/MonotonicArena.hpp>
+#include <memory/MonotonicAllocator.hpp>
+#include <memory/PoolAlloc.hpp>
+#include <memory/AlignedAlloc.hpp>
+#include <memory/ConcurrentMemAllocator.hpp>
 
 namespace dstruct {
     // Array
@@ -79,10 +95,14 @@ namespace dstruct {
     using Deque = DoubleEndedQueue<T, ArrSize, Alloc>;
     template <typename T, typename CMP = less<T>, typename Alloc = dstruct::Alloc>
     using PriorityQueue = Heap<T, CMP, Alloc>;
+    template <typename T, typename CMP = less<T>, typename Alloc = dstruct::Alloc>
+    using IndexedPriorityQueue = IndexedHeap<T, CMP, Alloc>;
 
 // Stack
     template <typename T, typename Alloc = dstruct::Alloc>
     using Stack = adapter::Stack<T, Vector<T, Alloc>>;
+    template <typename T, size_t N, typename Alloc = dstruct::Alloc>
+    using SmallStack = adapter::Stack<T, SmallVector<T, N, Alloc>>;
 
     //template <typename T, typename Compare, typename StackType = adapter::Stack<T, Vector<T>>>
     //class XValueStack;
@@ -97,6 +117,11 @@ namespace dstruct {
     using MinHeap = Heap<T, less<T>, Alloc>;
     template <typename T, typename Alloc = dstruct::Alloc>
     using MaxHeap = Heap<T, greater<T>, Alloc>;
+    // children of a node in one cache line when Arity * sizeof(T) divides DSTRUCT_CACHE_LINE_SIZE, static Alloc only
+    // storage is skewed by the Arity - 1 virtual padding slots before top
+    template <typename T, int Arity = 4, typename CMP = less<T>, typename Alloc = dstruct::Alloc>
+    using DAryHeap = Heap<T, CMP, AlignedAlloc<Alloc, DSTRUCT_CACHE_LINE_SIZE, (Arity - 1) * sizeof(T) % DSTRUCT_CACHE_LINE_SIZE>,
+        Vector<T, AlignedAlloc<Alloc, DSTRUCT_CACHE_LINE_SIZE, (Arity - 1) * sizeof(T) % DSTRUCT_CACHE_LINE_SIZE>>, Arity>;
 
 // Tree
 
@@ -109,9 +134,67 @@ namespace dstruct {
 
 // Set
     using UFSet = DisjointSet<dstruct::Alloc>;
+    template <typename T, typename Hash = hash<T>, typename Equal = equal_to<T>, typename Alloc = dstruct::Alloc>
+    using HashSet = HashTable<T, Hash, Equal, Alloc>;
+    template <typename T, typename CMP = less<T>, typename Alloc = dstruct::Alloc, int NodeBytes = DSTRUCT_CACHE_LINE_SIZE * 4>
+    using BTreeSet = BTree<T, BTreeKey<T>, CMP, Alloc, NodeBytes>;
+
+// Map
+    template <typename K, typename V, typename Hash = hash<K>, typename Equal = equal_to<K>, typename Alloc = dstruct::Alloc>
+    using HashMap = dstruct::Map<K, V, less<K>,
+        HashTable<KeyValue<const K, V>, KVHashKey<KeyValue<const K, V>, Hash>, KVEqualKey<KeyValue<const K, V>, Equal>, Alloc>
+    >;
+    template <typename K, typename V, typename CMP = less<K>, typename Alloc = dstruct::Alloc, int NodeBytes = DSTRUCT_CACHE_LINE_SIZE * 4>
+    using BTreeMap = dstruct::Map<K, V, CMP,
+        BTree<KeyValue<const K, V>, KVGetKey<KeyValue<const K, V>>, CMP, Alloc, NodeBytes>
+    >;
+    template <typename K, typename V, typename CMP = less<K>, typename Alloc = dstruct::Alloc>
+    using RBTreeMap = dstruct::Map<K, V, CMP,
+        RBTree<KeyValue<const K, V>, KVCMPKey<KeyValue<const K, V>, CMP>, Alloc>
+    >;
+
+namespace pmemory {
+// node-based dstruct with PoolAlloc(node-size pool), Upstream: mem-source of pool
+
+// SinglyLinkedList
+    template <typename T, typename Upstream = dstruct::Alloc>
+    using SLinkedList = SinglyLinkedList<T, PoolAlloc<sizeof(EmbeddedListNode_<T, SinglyLink_>), Upstream>>;
+
+// DoublyLinkedList
+    template <typename T, typename Upstream = dstruct::Alloc>
+    using DLinkedList = DoublyLinkedList<T, PoolAlloc<sizeof(EmbeddedListNode_<T, DoublyLink_>), Upstream>>;
+
+// Queue
+    template <typename T, size_t ArrSize = 32, typename Upstream = dstruct::Alloc>
+    using Deque = DoubleEndedQueue<T, ArrSize, PoolAlloc<sizeof(Array<T, ArrSize>), Upstream>>;
+    template <typename T, typename Upstream = dstruct::Alloc>
+    using Queue = adapter::Queue<T, pmemory::Deque<T, 32, Upstream>>;
+
+// Heap
+    template <typename T, typename CMP = less<T>, typename Upstream = dstruct::Alloc>
+    using PairingHeap = dstruct::PairingHeap<T, CMP, PoolAlloc<sizeof(PairingHeapNode_<T>), Upstream>>;
+
+// Tree
+    template <typename T, typename Upstream = dstruct::Alloc>
+    using BSTree = tree::BinarySearchTree<T, less<T>,
+        PoolAlloc<sizeof(tree::EmbeddedBinaryTreeNode<T>), Upstream>>;
+    template <typename T, typename CMP = less<T>, typename Upstream = dstruct::Alloc>
+    using AVLTree = dstruct::AVLTree<T, CMP,
+        PoolAlloc<sizeof(tree::EmbeddedBinaryTreeNode<AVLData_<T>>), Upstream>>;
+    template <typename T, typename CMP = less<T>, typename Upstream = dstruct::Alloc>
+    using RBTree = dstruct::RBTree<T, CMP, PoolAlloc<sizeof(tree::RBTreeNode<T>), Upstream>>;
 
 // Map
-    //...
+    template <typename K, typename V, typename CMP = less<K>, typename Upstream = dstruct::Alloc>
+    using Map = dstruct::Map<K, V, CMP,
+        pmemory::AVLTree<KeyValue<const K, V>, KVCMPKey<KeyValue<const K, V>, CMP>, Upstream>
+    >;
+    template <typename K, typename V, typename CMP = less<K>, typename Upstream = dstruct::Alloc>
+    using RBTreeMap = dstruct::Map<K, V, CMP,
+        pmemory::RBTree<KeyValue<const K, V>, KVCMPKey<KeyValue<const K, V>, CMP>, Upstream>
+    >;
+}
+
 };
 
 #endif
\ No newline at end of file
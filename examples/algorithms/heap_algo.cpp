@@ -8,6 +8,8 @@
 //
 
 #include <iostream>
+#include <string>
+#include <algorithm> // std::make_heap... are found by ADL for std types
 
 #include <dstruct.hpp>
 
@@ -16,6 +18,108 @@ bool cmp_func(int a, int b) {
     return a < b;
 }
 
+template <typename Iterator>
+static bool is_sorted(Iterator first, Iterator last) {
+    for (auto it = first + 1; it != last && first != last; it++) {
+        if (*it < *(it - 1)) return false;
+    }
+    return true;
+}
+
+// in-place heap algorithms on different random iterators
+static void test_heap_algorithm() {
+    const int n = 1000;
+    dstruct::Vector<int> vec;
+    dstruct::Vector<int> vec2;
+    int arr[n];
+    unsigned int seed = 2023;
+    long long sum = 0;
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1103515245 + 12345;
+        arr[i] = (seed >> 8) % 500; // with duplicates
+        vec.push_back(arr[i]);
+        vec2.push_back(arr[i]);
+        sum += arr[i];
+    }
+
+    // make_heap + sort_heap
+    dstruct::algorithm::make_heap(arr, arr + n);
+    DSTRUCT_ASSERT(dstruct::algorithm::is_heap(arr, arr + n));
+    dstruct::algorithm::sort_heap(arr, arr + n);
+    DSTRUCT_ASSERT(is_sorted(arr, arr + n));
+
+    dstruct::algorithm::make_heap(vec2.begin(), vec2.end());
+    DSTRUCT_ASSERT(dstruct::algorithm::is_heap(vec2.begin(), vec2.end()));
+    dstruct::algorithm::sort_heap(vec2.begin(), vec2.end());
+    for (int i = 0; i < n; i++) {
+        DSTRUCT_ASSERT(vec2[i] == arr[i]);
+    }
+
+    // push_heap / pop_heap, greater: min at top
+    dstruct::Vector<int> heap;
+    for (int i = 0; i < n; i++) {
+        heap.push_back(vec[i]);
+        dstruct::algorithm::push_heap(heap.begin(), heap.end(), dstruct::greater<int>());
+    }
+    DSTRUCT_ASSERT(dstruct::algorithm::is_heap(heap.begin(), heap.end(), dstruct::greater<int>()));
+    for (int i = 0; i < n; i++) {
+        DSTRUCT_ASSERT(heap[0] == arr[i]);
+        dstruct::algorithm::pop_heap(heap.begin(), heap.end(), dstruct::greater<int>());
+        heap.pop_back();
+    }
+
+    // partial_sort: the smallest 100 in order
+    dstruct::algorithm::partial_sort(vec.begin(), vec.begin() + 100, vec.end());
+    long long vecSum = 0;
+    for (int i = 0; i < n; i++) {
+        if (i < 100) DSTRUCT_ASSERT(vec[i] == arr[i]);
+        vecSum += vec[i];
+    }
+    DSTRUCT_ASSERT(vecSum == sum);
+
+    // non-trivial type
+    dstruct::Vector<dstruct::String> strs;
+    strs.push_back("c-string-without-sso");
+    strs.push_back("a-string-without-sso");
+    strs.push_back("b-string-without-sso");
+    auto byLen = [](const dstruct::String &s1, const dstruct::String &s2) { return s1[0] < s2[0]; };
+    dstruct::algorithm::make_heap(strs.begin(), strs.end(), byLen);
+    dstruct::algorithm::sort_heap(strs.begin(), strs.end(), byLen);
+    DSTRUCT_ASSERT(strs[0] == "a-string-without-sso" && strs[2] == "c-string-without-sso");
+
+    // deque iterator
+    dstruct::Deque<int> deque;
+    for (int i = 0; i < n; i++) {
+        if (i % 2) deque.push_back(vec2[i]);
+        else deque.push_front(vec2[i]);
+    }
+    dstruct::algorithm::make_heap(deque.begin(), deque.end());
+    DSTRUCT_ASSERT(dstruct::algorithm::is_heap(deque.begin(), deque.end()));
+    dstruct::algorithm::sort_heap(deque.begin(), deque.end());
+    for (int i = 0; i < n; i++) {
+        DSTRUCT_ASSERT(deque[i] == arr[i]);
+    }
+
+    // std type: the std:: overloads are candidates too
+    dstruct::Vector<std::string> stdStrs;
+    stdStrs.push_back("c"); stdStrs.push_back("a"); stdStrs.push_back("d"); stdStrs.push_back("b");
+    dstruct::algorithm::make_heap(stdStrs.begin(), stdStrs.end());
+    DSTRUCT_ASSERT(dstruct::algorithm::is_heap(stdStrs.begin(), stdStrs.end()));
+    dstruct::algorithm::push_heap(stdStrs.begin(), stdStrs.end());
+    dstruct::algorithm::pop_heap(stdStrs.begin(), stdStrs.end());
+    DSTRUCT_ASSERT(stdStrs[3] == "d");
+    dstruct::algorithm::sort_heap(stdStrs.begin(), stdStrs.end() - 1);
+    DSTRUCT_ASSERT(stdStrs[0] == "a" && stdStrs[2] == "c" && stdStrs[3] == "d");
+    std::string stdArr[4] = { "d", "c", "b", "a" };
+    dstruct::algorithm::partial_sort(stdArr, stdArr + 2, stdArr + 4);
+    DSTRUCT_ASSERT(stdArr[0] == "a" && stdArr[1] == "b");
+
+    // edge cases
+    dstruct::algorithm::make_heap(arr, arr);
+    dstruct::algorithm::sort_heap(arr, arr + 1);
+    dstruct::algorithm::partial_sort(arr, arr, arr + n);
+}
+
 int main() {
 
     std::cout << "\nTesting: " << __FILE__;
@@ -72,6 +176,8 @@ int main() {
         dstruct::Heap<int, decltype(myCmp)> heap2(myCmp);
     }
 
+    test_heap_algorithm();
+
     std::cout << "   pass" << std::endl;
 
     return 0;
@@ -0,0 +1,175 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+
+#include <dstruct.hpp>
+
+/*
+ThreadPool: a small fork-join pool on WorkStealingDeque
+
+    worker 0 is the caller thread, worker 1 ~ n-1 are pool threads
+    each worker own a deque, a task [begin, end) bigger than grain is split:
+        push [mid, end) to its own deque(bottom), continue with [begin, mid)
+    idle worker steal the oldest(biggest) task from other deques(top)
+*/
+
+class ThreadPool {
+
+    // 8 bytes, std::atomic<Task_> in the deque is lock-free
+    struct Task_ {
+        unsigned int begin, end;
+    };
+
+    using Deque_ = dstruct::WorkStealingDeque<Task_>;
+
+public:
+    static constexpr int MAX_WORKER_NUM = 16;
+
+    explicit ThreadPool(int workerNum) :
+        mStop_d { false }, mDoneNum_d { 0 }, mTaskNum_d { 0 }, mWorkerNum_d { workerNum } {
+        DSTRUCT_ASSERT(workerNum >= 1 && workerNum <= MAX_WORKER_NUM);
+        for (int i = 1; i < workerNum; i++) {
+            mThreads_d.push_back(new std::thread(&ThreadPool::_worker_loop, this, i));
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool() {
+        mStop_d.store(true);
+        for (auto t : mThreads_d) {
+            t->join();
+            delete t;
+        }
+    }
+
+    int worker_num() const {
+        return mWorkerNum_d;
+    }
+
+    // call cb(*it) for it in [begin, begin + n), only called by the thread created the pool
+    template <typename Iterator, typename Callback>
+    void for_each(const Iterator &begin, unsigned int n, Callback cb, unsigned int grain = 1024) {
+        if (n == 0) return;
+
+        Context_<Iterator, Callback> ctx { begin, cb };
+        mRun_d = &ThreadPool::_run<Iterator, Callback>;
+        mCtx_d = &ctx;
+        mGrain_d = grain > 0 ? grain : 1;
+        mDoneNum_d.store(0, std::memory_order_relaxed);
+        mTaskNum_d.store(n, std::memory_order_release); // publish the job
+
+        mDeques_d[0].push(Task_ { 0, n });
+        while (mDoneNum_d.load(std::memory_order_acquire) < n) {
+            if (!_work_once(0)) std::this_thread::yield();
+        }
+
+        mTaskNum_d.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    template <typename Iterator, typename Callback>
+    struct Context_ {
+        Iterator begin;
+        Callback &cb;
+    };
+
+    std::atomic<bool> mStop_d;
+    std::atomic<size_t> mDoneNum_d;
+    std::atomic<size_t> mTaskNum_d; // elements of current for_each, 0: idle
+    // current job, set before mTaskNum_d is published
+    void (*mRun_d)(void *ctx, size_t begin, size_t end);
+    void *mCtx_d;
+    unsigned int mGrain_d;
+    int mWorkerNum_d;
+    // by value: plain new doesn't honor the cache line alignment of Deque_ in c++11
+    Deque_ mDeques_d[MAX_WORKER_NUM];
+    dstruct::Vector<std::thread *> mThreads_d;
+
+    template <typename Iterator, typename Callback>
+    static void _run(void *ctx, size_t begin, size_t end) {
+        auto c = static_cast<Context_<Iterator, Callback> *>(ctx);
+        dstruct::algorithm::for_each(c->begin + begin, c->begin + end, c->cb);
+    }
+
+    void _worker_loop(int id) {
+        while (!mStop_d.load(std::memory_order_relaxed)) {
+            if (mTaskNum_d.load(std::memory_order_acquire) == 0 || !_work_once(id)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // pop own task or steal one, split it down to grain and run, false when no task
+    bool _work_once(int id) {
+        Task_ task;
+        if (!mDeques_d[id].pop(task) && !_steal(id, task)) return false;
+
+        while (task.end - task.begin > mGrain_d) {
+            unsigned int mid = task.begin + (task.end - task.begin) / 2;
+            mDeques_d[id].push(Task_ { mid, task.end });
+            task.end = mid;
+        }
+
+        mRun_d(mCtx_d, task.begin, task.end);
+        mDoneNum_d.fetch_add(task.end - task.begin, std::memory_order_release);
+
+        return true;
+    }
+
+    bool _steal(int id, Task_ &task) {
+        int n = mWorkerNum_d;
+        for (int i = 1; i < n; i++) {
+            if (mDeques_d[(id + i) % n].steal(task)) return true;
+        }
+        return false;
+    }
+};
+
+static void test_parallel_for_each(int workerNum) {
+    const int n = 100000;
+    dstruct::Vector<int> vec(n, 0);
+    ThreadPool pool(workerNum);
+
+    for (int i = 0; i < n; i++) vec[i] = i;
+
+    // write: every element is visited exactly once
+    pool.for_each(vec.begin(), vec.size(), [](int &obj) { obj *= 2; }, 100);
+    for (int i = 0; i < n; i++) {
+        DSTRUCT_ASSERT(vec[i] == 2 * i);
+    }
+
+    // read: reuse the pool
+    std::atomic<long long> sum { 0 };
+    pool.for_each(vec.begin(), vec.size(), [&](int obj) { sum.fetch_add(obj, std::memory_order_relaxed); });
+    DSTRUCT_ASSERT(sum == static_cast<long long>(n) * (n - 1));
+
+    // other random-access iterator
+    dstruct::Array<int, 10> arr;
+    pool.for_each(arr.begin(), arr.size(), [](int &obj) { obj = 1; }, 1);
+    sum = 0;
+    dstruct::algorithm::for_each(arr.begin(), arr.end(), [&](int obj) { sum += obj; });
+    DSTRUCT_ASSERT(sum == 10);
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_parallel_for_each(1);
+    test_parallel_for_each(4);
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
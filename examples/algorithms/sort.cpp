@@ -0,0 +1,213 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+#include <string>
+#include <functional>
+#include <algorithm> // std::sort... are found by ADL for std types
+
+#include <dstruct.hpp>
+
+template <typename Iterator, typename Compare>
+static bool is_sorted(Iterator first, Iterator last, Compare cmp) {
+    for (auto it = first + 1; first != last && it != last; it++) {
+        if (cmp(*it, *(it - 1))) return false;
+    }
+    return true;
+}
+
+// random, sorted, reversed, organ pipe, sawtooth, all equal, few distinct
+static void gen_pattern(dstruct::Vector<int> &vec, int pattern, int n) {
+    unsigned int seed = 2023 + n;
+    vec.clear();
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1103515245 + 12345;
+        int val = 0;
+        switch (pattern) {
+            case 0: val = static_cast<int>(seed >> 4); break;
+            case 1: val = i; break;
+            case 2: val = n - i; break;
+            case 3: val = i < n / 2 ? i : n - i; break;
+            case 4: val = i % 64; break;
+            case 5: val = 7; break;
+            default: val = (seed >> 16) % 4; break;
+        }
+        vec.push_back(val);
+    }
+    if (pattern == 1 && n > 10) vec[n / 3] = -1; // nearly sorted
+}
+
+static long long sum_of(const dstruct::Vector<int> &vec) {
+    long long sum = 0;
+    for (auto it = vec.begin(); it != vec.end(); it++) sum += *it;
+    return sum;
+}
+
+static void test_sort() {
+    const int sizes[] = { 0, 1, 2, 3, 23, 24, 25, 100, 129, 1000, 30000 };
+    dstruct::Vector<int> vec;
+
+    for (int n : sizes) {
+        for (int pattern = 0; pattern < 7; pattern++) {
+            gen_pattern(vec, pattern, n);
+            long long sum = sum_of(vec);
+            dstruct::algorithm::sort(vec.begin(), vec.end());
+            DSTRUCT_ASSERT(is_sorted(vec.begin(), vec.end(), dstruct::less<int>()));
+            DSTRUCT_ASSERT(sum_of(vec) == sum);
+
+            gen_pattern(vec, pattern, n);
+            dstruct::algorithm::sort(vec.begin(), vec.end(), dstruct::greater<int>());
+            DSTRUCT_ASSERT(is_sorted(vec.begin(), vec.end(), dstruct::greater<int>()));
+            DSTRUCT_ASSERT(sum_of(vec) == sum);
+        }
+    }
+
+    int arr[] = { 5, 3, 9, 1, 1, 8, 2, 7 };
+    dstruct::algorithm::sort(arr, arr + 8);
+    DSTRUCT_ASSERT(arr[0] == 1 && arr[1] == 1 && arr[2] == 2 && arr[7] == 9);
+}
+
+struct Record {
+    int key, index;
+};
+
+struct KeyLess {
+    bool operator()(const Record &r1, const Record &r2) const {
+        return r1.key < r2.key;
+    }
+};
+
+static void test_stable_sort() {
+    const int sizes[] = { 0, 1, 16, 17, 100, 1000, 30000 };
+    dstruct::Vector<Record> records;
+
+    for (int n : sizes) {
+        for (int pattern = 0; pattern < 7; pattern++) {
+            dstruct::Vector<int> keys;
+            gen_pattern(keys, pattern, n);
+            records.clear();
+            for (int i = 0; i < n; i++) {
+                records.push_back(Record { keys[i] % 100, i });
+            }
+
+            dstruct::algorithm::stable_sort(records.begin(), records.end(), KeyLess());
+            for (int i = 1; i < n; i++) {
+                DSTRUCT_ASSERT(records[i - 1].key <= records[i].key);
+                if (records[i - 1].key == records[i].key) {
+                    DSTRUCT_ASSERT(records[i - 1].index < records[i].index);
+                }
+            }
+        }
+    }
+
+    dstruct::Vector<int> vec;
+    gen_pattern(vec, 0, 1000);
+    dstruct::algorithm::stable_sort(vec.begin(), vec.end());
+    DSTRUCT_ASSERT(is_sorted(vec.begin(), vec.end(), dstruct::less<int>()));
+}
+
+static void test_nth_element() {
+    dstruct::Vector<int> vec, sorted;
+
+    for (int pattern = 0; pattern < 7; pattern++) {
+        gen_pattern(sorted, pattern, 5000);
+        dstruct::algorithm::sort(sorted.begin(), sorted.end());
+
+        const int nths[] = { 0, 1, 100, 2500, 4998, 4999 };
+        for (int nth : nths) {
+            gen_pattern(vec, pattern, 5000);
+            dstruct::algorithm::nth_element(vec.begin(), vec.begin() + nth, vec.end());
+            DSTRUCT_ASSERT(vec[nth] == sorted[nth]);
+            for (int i = 0; i < nth; i++) DSTRUCT_ASSERT(vec[i] <= vec[nth]);
+            for (int i = nth + 1; i < 5000; i++) DSTRUCT_ASSERT(vec[nth] <= vec[i]);
+        }
+    }
+}
+
+struct ShorterFirst {
+    bool operator()(const dstruct::String &s1, const dstruct::String &s2) const {
+        return s1.size() < s2.size();
+    }
+};
+
+// non-trivial type, objs are moved
+static void test_string() {
+    dstruct::Vector<dstruct::String> strs;
+    char buff[65];
+    for (int i = 0; i < 300; i++) {
+        int len = (i * 37) % 64 + 1;
+        for (int j = 0; j < len; j++) buff[j] = 'a' + (i + j) % 26;
+        buff[len] = '\0';
+        strs.push_back(dstruct::String(buff));
+    }
+
+    dstruct::Vector<dstruct::String> input(strs), copy(strs);
+    dstruct::algorithm::sort(strs.begin(), strs.end(), ShorterFirst());
+    DSTRUCT_ASSERT(is_sorted(strs.begin(), strs.end(), ShorterFirst()));
+
+    // same length, keep the input order
+    dstruct::algorithm::stable_sort(copy.begin(), copy.end(), ShorterFirst());
+    DSTRUCT_ASSERT(is_sorted(copy.begin(), copy.end(), ShorterFirst()));
+    int lastIndex = -1;
+    for (int i = 0; i < 300; i++) {
+        int index = 0;
+        while (!(input[index] == copy[i])) index++;
+        if (i > 0 && copy[i - 1].size() == copy[i].size()) {
+            DSTRUCT_ASSERT(lastIndex < index);
+        }
+        lastIndex = index;
+    }
+}
+
+// std types: the std:: overloads are candidates too, calls must not be ambiguous
+static void test_std_type() {
+    const int n = 300;
+    dstruct::Vector<std::string> strs;
+    std::string arr[n];
+    for (int i = 0; i < n; i++) {
+        arr[i] = std::to_string((i * 7919) % n);
+        strs.push_back(arr[i]);
+    }
+
+    dstruct::algorithm::sort(arr, arr + n);
+    DSTRUCT_ASSERT(::is_sorted(arr, arr + n, std::less<std::string>()));
+
+    dstruct::Vector<std::string> copy(strs);
+    dstruct::algorithm::sort(strs.begin(), strs.end());
+    dstruct::algorithm::stable_sort(copy.begin(), copy.end());
+    for (int i = 0; i < n; i++) DSTRUCT_ASSERT(strs[i] == arr[i] && copy[i] == arr[i]);
+
+    int nums[n];
+    for (int i = 0; i < n; i++) nums[i] = (i * 7919) % n;
+    dstruct::algorithm::nth_element(nums, nums + 100, nums + n, std::less<int>());
+    DSTRUCT_ASSERT(nums[100] == 100);
+    dstruct::algorithm::sort(nums, nums + n, std::greater<int>());
+    DSTRUCT_ASSERT(::is_sorted(nums, nums + n, std::greater<int>()));
+
+    // deque iterator
+    dstruct::Deque<int> deque;
+    for (int i = 0; i < n; i++) deque.push_front((i * 7919) % n);
+    dstruct::algorithm::sort(deque.begin(), deque.end());
+    for (int i = 0; i < n; i++) DSTRUCT_ASSERT(deque[i] == i);
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_sort();
+    test_stable_sort();
+    test_nth_element();
+    test_string();
+    test_std_type();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+
+#include <dstruct.hpp>
+
+struct CountAlloc {
+    static int allocateCnt, deallocateCnt;
+
+    static void * allocate(int bytes) {
+        allocateCnt++;
+        return dstruct::Alloc::allocate(bytes);
+    }
+
+    static void deallocate(void *addr, int bytes) {
+        deallocateCnt++;
+        dstruct::Alloc::deallocate(addr, bytes);
+    }
+};
+
+int CountAlloc::allocateCnt = 0;
+int CountAlloc::deallocateCnt = 0;
+
+static void test_inline_and_spill() {
+    dstruct::SmallVector<int, 8, CountAlloc> sVec;
+
+    DSTRUCT_ASSERT(sVec.is_inline() && sVec.capacity() == 8);
+    for (int i = 0; i < 8; i++) sVec.push_back(i);
+    DSTRUCT_ASSERT(CountAlloc::allocateCnt == 0 && sVec.is_inline());
+
+    sVec.push_back(8); // spill to heap
+    DSTRUCT_ASSERT(CountAlloc::allocateCnt == 1 && !sVec.is_inline() && sVec.capacity() == 16);
+    for (int i = 9; i < 100; i++) sVec.push_back(i);
+
+    int sum = 0;
+    for (auto v : sVec) sum += v;
+    DSTRUCT_ASSERT(sVec.size() == 100 && sVec[-1] == 99 && sum == 4950);
+
+    // shrink back to inline buffer, capacity never less than N
+    while (sVec.size() > 2) sVec.pop_back();
+    DSTRUCT_ASSERT(sVec.is_inline() && sVec.capacity() == 8 && sVec.back() == 1);
+    DSTRUCT_ASSERT(CountAlloc::allocateCnt == CountAlloc::deallocateCnt);
+
+    sVec.resize(20, 7);
+    DSTRUCT_ASSERT(!sVec.is_inline() && sVec.size() == 20 && sVec[1] == 1 && sVec[19] == 7);
+    sVec.resize(3);
+    sVec.shrink_to_fit();
+    DSTRUCT_ASSERT(sVec.is_inline() && sVec.size() == 3 && sVec[2] == 7);
+    DSTRUCT_ASSERT(CountAlloc::allocateCnt == CountAlloc::deallocateCnt);
+}
+
+static void test_copy_move() {
+    dstruct::SmallVector<dstruct::String, 4> sVec1;
+    for (int i = 0; i < 3; i++) sVec1.push_back("dstruct");
+
+    auto sVec2 = sVec1; // inline copy
+    DSTRUCT_ASSERT(sVec2.is_inline() && sVec2.size() == 3 && sVec2[2] == "dstruct");
+
+    auto sVec3 = dstruct::move(sVec2); // inline move: move elements
+    DSTRUCT_ASSERT(sVec3.is_inline() && sVec3.size() == 3 && sVec2.empty());
+
+    for (int i = 0; i < 10; i++) sVec3.push_back(sVec3[0]);
+    auto heapBuffer = sVec3.begin();
+    auto sVec4 = dstruct::move(sVec3); // heap move: take over buffer
+    DSTRUCT_ASSERT(sVec4.begin() == heapBuffer && sVec4.size() == 13 && sVec3.empty());
+
+    sVec3 = sVec4;
+    DSTRUCT_ASSERT(sVec3.size() == 13 && sVec3.begin() != heapBuffer && sVec3[-1] == "dstruct");
+
+    // moved-from SmallVector is still usable
+    sVec2.push_back("reuse");
+    DSTRUCT_ASSERT(sVec2.is_inline() && sVec2.back() == "reuse");
+}
+
+static void test_adapter() {
+    CountAlloc::allocateCnt = 0;
+
+    dstruct::SmallStack<int, 16, CountAlloc> stack;
+    for (int i = 0; i < 16; i++) stack.push(i);
+    DSTRUCT_ASSERT(stack.top() == 15 && stack.size() == 16);
+    while (!stack.empty()) stack.pop();
+
+    // Heap storage holds objs only, N = 16 for 16 elements
+    using SmallMinHeap = dstruct::Heap<int, dstruct::less<int>, CountAlloc,
+        dstruct::SmallVector<int, 16, CountAlloc>>;
+    SmallMinHeap heap;
+    for (int i = 16; i > 0; i--) heap.push(i);
+    DSTRUCT_ASSERT(heap.top() == 1 && heap.size() == 16);
+    heap.pop();
+    DSTRUCT_ASSERT(heap.top() == 2);
+
+    DSTRUCT_ASSERT(CountAlloc::allocateCnt == 0);
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_inline_and_spill();
+    test_copy_move();
+    test_adapter();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
@@ -11,6 +11,149 @@
 
 #include <dstruct.hpp>
 
+struct Counter {
+    static int copyCnt, moveCnt;
+    int val;
+
+    Counter(int v = 0) : val { v } { }
+    Counter(const Counter &c) : val { c.val } { copyCnt++; }
+    Counter(Counter &&c) : val { c.val } { moveCnt++; c.val = -1; }
+    Counter & operator=(const Counter &c) { val = c.val; copyCnt++; return *this; }
+};
+
+int Counter::copyCnt = 0;
+int Counter::moveCnt = 0;
+
+static void test_move_semantics() {
+    dstruct::Vector<Counter> cVec;
+    Counter c(1);
+
+    cVec.push_back(dstruct::move(c)); // move
+    DSTRUCT_ASSERT(Counter::copyCnt == 0 && Counter::moveCnt == 1 && c.val == -1);
+
+    for (int i = 0; i < 100; i++) {
+        cVec.emplace_back(i); // construct in place, growth by move
+    }
+    DSTRUCT_ASSERT(Counter::copyCnt == 0 && cVec.size() == 101 && cVec.back().val == 99);
+
+    // nested buffer: relocate by memcpy, not deep-copy
+    dstruct::Vector<dstruct::Vector<int>> vv;
+    vv.push_back(dstruct::Vector<int>(8, 1));
+    auto innerBuffer = vv[0].begin();
+    for (int i = 0; i < 100; i++) {
+        vv.emplace_back(4, i);
+    }
+    DSTRUCT_ASSERT(vv[0].begin() == innerBuffer && vv[100][3] == 99);
+
+    // element refer to self
+    dstruct::Vector<dstruct::String> strVec;
+    strVec.push_back("dstruct");
+    for (int i = 0; i < 20; i++) {
+        strVec.push_back(strVec[0]);
+    }
+    DSTRUCT_ASSERT(strVec.size() == 21 && strVec[-1] == "dstruct");
+
+    auto vvCopy = vv;
+    DSTRUCT_ASSERT(vvCopy.size() == vv.size() && vvCopy[100][3] == 99 && vvCopy[0].begin() != innerBuffer);
+}
+
+static void test_capacity_policy() {
+    dstruct::Vector<int> vec;
+
+    vec.reserve(100);
+    DSTRUCT_ASSERT(vec.capacity() == 100 && vec.empty());
+    for (int i = 0; i < 100; i++) vec.push_back(i); // no realloc
+    DSTRUCT_ASSERT(vec.capacity() == 100);
+    vec.push_back(100);
+    DSTRUCT_ASSERT(vec.capacity() == 200);
+    vec.shrink_to_fit();
+    DSTRUCT_ASSERT(vec.capacity() == 101 && vec[100] == 100);
+
+    // default: shrink to half when size < capacity / 4
+    while (vec.size() >= 101 / 4) vec.pop_back();
+    DSTRUCT_ASSERT(vec.capacity() == 50 && vec.back() == 23);
+
+    dstruct::Vector<int, dstruct::Alloc, dstruct::vector::NoShrinkPolicy> noShrinkVec(64, 1);
+    while (!noShrinkVec.empty()) noShrinkVec.pop_back();
+    DSTRUCT_ASSERT(noShrinkVec.capacity() == 64);
+
+    dstruct::Vector<int, dstruct::Alloc, dstruct::vector::Growth1_5xPolicy> vec1_5x;
+    vec1_5x.reserve(10);
+    for (int i = 0; i < 11; i++) vec1_5x.push_back(i);
+    DSTRUCT_ASSERT(vec1_5x.capacity() == 15);
+}
+
+// deallocate bytes must match allocate bytes for SMA
+static void test_sma_accounting() {
+    using SMA = dstruct::StaticMemAllocator<256 * 1024>;
+    const int freeMemSize = SMA::free_mem_size();
+    {
+        dstruct::Vector<int, SMA> vec;
+        for (int round = 0; round < 10; round++) {
+            for (int i = 0; i < 1000; i++) vec.push_back(i);
+            auto vecCopy = vec;
+            vecCopy.shrink_to_fit();
+            for (int i = 0; i < 990; i++) vec.pop_back();
+            vec.reserve(2000);
+            vec.resize(5, 1);
+        }
+        vec.clear();
+        DSTRUCT_ASSERT(SMA::free_mem_size() == freeMemSize);
+        vec.resize(100, 2);
+    }
+    SMA::memory_merge();
+    DSTRUCT_ASSERT(SMA::free_mem_size() == freeMemSize);
+}
+
+static void test_bulk_ops() {
+    int data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    dstruct::Vector<int> vec;
+
+    vec.append(data, data + 10);
+    DSTRUCT_ASSERT(vec.size() == 10 && vec.capacity() == 10 && vec[9] == 9);
+
+    vec.reserve(40);
+    vec.insert(vec.begin() + 2, data, data + 3); // 0 1 [0 1 2] 2 3 ...
+    DSTRUCT_ASSERT(vec.size() == 13 && vec[2] == 0 && vec[4] == 2 && vec[5] == 2 && vec[12] == 9);
+
+    vec.insert(vec.begin(), vec.begin() + 10, vec.end()); // range of self
+    DSTRUCT_ASSERT(vec.size() == 16 && vec[0] == 7 && vec[2] == 9 && vec[3] == 0);
+
+    auto it = vec.erase(vec.begin(), vec.begin() + 3);
+    DSTRUCT_ASSERT(vec.size() == 13 && *it == 0 && vec[-1] == 9);
+    it = vec.erase(vec.begin() + 2, vec.begin() + 5);
+    DSTRUCT_ASSERT(vec.size() == 10 && *it == 2 && vec[2] == 2 && vec[9] == 9);
+    for (int i = 0; i < 10; i++) DSTRUCT_ASSERT(vec[i] == i);
+
+    vec.append(vec.begin(), vec.end()); // may grow, range of self
+    DSTRUCT_ASSERT(vec.size() == 20 && vec[10] == 0 && vec[19] == 9);
+
+    vec.assign(5, vec[3]);
+    DSTRUCT_ASSERT(vec.size() == 5 && vec[0] == 3 && vec[4] == 3);
+    vec.assign(100, vec[0]);
+    DSTRUCT_ASSERT(vec.size() == 100 && vec.capacity() == 100 && vec[99] == 3);
+
+    // non-trivially relocatable element
+    Counter::copyCnt = Counter::moveCnt = 0;
+    dstruct::Vector<Counter> cVec;
+    cVec.reserve(16);
+    cVec.append(data, data + 8);
+    cVec.insert(cVec.begin() + 1, data, data + 4);
+    DSTRUCT_ASSERT(Counter::copyCnt == 0 && Counter::moveCnt == 7);
+    DSTRUCT_ASSERT(cVec.size() == 12 && cVec[1].val == 0 && cVec[4].val == 3 && cVec[5].val == 1);
+    cVec.erase(cVec.begin() + 1, cVec.begin() + 5);
+    for (int i = 0; i < 8; i++) DSTRUCT_ASSERT(cVec[i].val == i);
+
+    // range of other dstruct
+    dstruct::DLinkedList<dstruct::String> strList;
+    strList.push_back("d"); strList.push_back("struct");
+    dstruct::Vector<dstruct::String> strVec(1, "lib");
+    strVec.insert(strVec.begin(), strList.begin(), strList.end());
+    DSTRUCT_ASSERT(strVec.size() == 3 && strVec[0] == "d" && strVec[1] == "struct" && strVec[2] == "lib");
+    strVec.erase(strVec.begin());
+    DSTRUCT_ASSERT(strVec.size() == 2 && strVec[0] == "struct");
+}
+
 int main() {
 
     std::cout << "\nTesting: " << __FILE__;
@@ -52,6 +195,11 @@ int main() {
 
     DSTRUCT_ASSERT(vec.empty());
 
+    test_move_semantics();
+    test_capacity_policy();
+    test_sma_accounting();
+    test_bulk_ops();
+
     std::cout << "   pass" << std::endl;
 
     return 0;
@@ -0,0 +1,334 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+
+#include <dstruct.hpp>
+#include <TestBase.hpp>
+
+// small node: 10 objs per leaf, 4 keys per inner node - deep tree, many split/merge
+template <typename T>
+using SmallNodeSet = dstruct::BTreeSet<T, dstruct::less<T>, dstruct::Alloc, 64>;
+
+template <typename Set>
+static bool is_sorted_unique(const Set &set) {
+    auto it = set.begin();
+    if (it == set.end()) return true;
+    auto last = *it;
+    for (it++; it != set.end(); it++) {
+        if (!(last < *it)) return false;
+        last = *it;
+    }
+    return true;
+}
+
+static void test_btree_set() {
+    SmallNodeSet<int> set;
+    DSTRUCT_ASSERT(set.empty() && set.height() == 0 && set.begin() == set.end());
+
+    const int n = 5000;
+    for (int i = 0; i < n; i++) set.push((i * 7919) % n);
+    set.push(0); // exist
+    DSTRUCT_ASSERT(set.size() == n && is_sorted_unique(set));
+    DSTRUCT_ASSERT(set.height() > 3 && set.capacity() >= set.size());
+
+    int num = 0;
+    for (int obj : set) DSTRUCT_ASSERT(obj == num++);
+    DSTRUCT_ASSERT(num == n);
+
+    for (int i = -10; i < n + 10; i++) {
+        DSTRUCT_ASSERT(set.contains(i) == (i >= 0 && i < n));
+    }
+
+    // erase while iterating: remove odd
+    for (auto it = set.begin(); it != set.end(); ) {
+        if (*it % 2) it = set.erase(it);
+        else it++;
+    }
+    DSTRUCT_ASSERT(set.size() == n / 2 && is_sorted_unique(set));
+    DSTRUCT_ASSERT(*set.lower_bound(101) == 102 && set.lower_bound(n) == set.end());
+
+    set.pop(0);
+    set.pop(1); // not exist
+    DSTRUCT_ASSERT(set.size() == n / 2 - 1 && *set.begin() == 2);
+
+    // copy / move
+    SmallNodeSet<int> copySet(set);
+    SmallNodeSet<int> moveSet(dstruct::move(set));
+    DSTRUCT_ASSERT(set.empty() && set.find(2) == set.end());
+    DSTRUCT_ASSERT(copySet.size() == n / 2 - 1 && moveSet.size() == n / 2 - 1);
+    DSTRUCT_ASSERT(copySet.contains(4998) && moveSet.contains(4998) && is_sorted_unique(copySet));
+
+    // pop all, tree shrinks to empty
+    for (int i = 0; i < n; i++) copySet.pop(i);
+    DSTRUCT_ASSERT(copySet.empty() && copySet.height() == 0 && copySet.capacity() == 0);
+    copySet.push(3);
+    DSTRUCT_ASSERT(copySet.size() == 1 && *copySet.begin() == 3);
+
+    moveSet.clear();
+    DSTRUCT_ASSERT(moveSet.empty() && moveSet.begin() == moveSet.end());
+}
+
+// white-box view of a small node BTree: node fill, separators, leaf list, siblings of a node
+class BTreeView : public SmallNodeSet<int> {
+public:
+    using SmallNodeSet<int>::LEAF_CAP;
+    using SmallNodeSet<int>::INNER_MIN;
+
+    // the parent P of the leaf holding key, and P's siblings in the grandparent G
+    struct Family {
+        int index;          // P is G->children[index]
+        int grandCount;     // keys of G
+        int count;          // keys of P
+        int leftCount;      // keys of P's left/right sibling, -1: none
+        int rightCount;
+        int low, high;      // separators around P in G, keys of P in [low, high)
+    };
+
+    Family family(int key) const {
+        DSTRUCT_ASSERT(mHeight_d >= 3);
+        Path_ path[MAX_DEPTH];
+        _descend(key, path);
+        const Path_ &p = path[mHeight_d - 2], &g = path[mHeight_d - 3];
+        const Inner_ *grand = g.node;
+
+        Family f;
+        f.index = g.index;
+        f.grandCount = grand->count;
+        f.count = p.node->count;
+        f.leftCount = g.index > 0 ? static_cast<const Inner_ *>(grand->children[g.index - 1])->count : -1;
+        f.rightCount = g.index < grand->count ? static_cast<const Inner_ *>(grand->children[g.index + 1])->count : -1;
+        f.low = g.index > 0 ? grand->keys()[g.index - 1] : -1;
+        f.high = g.index < grand->count ? grand->keys()[g.index] : -1;
+        return f;
+    }
+
+    bool is_valid() const {
+        if (mRoot_d == nullptr) {
+            return mSize_d == 0 && mFirst_d == nullptr && mHeight_d == 0 && mLeafNum_d == 0;
+        }
+        const Leaf_ *last = nullptr;
+        unsigned long long objNum = 0, leafNum = 0;
+        if (!_check_node(mRoot_d, 1, nullptr, nullptr, last, objNum, leafNum)) return false;
+        return last->next == nullptr && objNum == mSize_d && leafNum == mLeafNum_d;
+    }
+
+private:
+    // objs/keys of node in [*low, *high), nullptr: no bound
+    bool _check_node(const void *node, int level, const int *low, const int *high,
+        const Leaf_ *&last, unsigned long long &objNum, unsigned long long &leafNum) const {
+        if (level == mHeight_d) {
+            const Leaf_ *leaf = static_cast<const Leaf_ *>(node);
+            if (leaf->count > LEAF_CAP || leaf->count < (level == 1 ? 1 : LEAF_MIN)) return false;
+            if (leaf->prev != last || (last ? last->next : mFirst_d) != leaf) return false;
+            for (int i = 0; i < leaf->count; i++) {
+                int obj = leaf->slots()[i];
+                if (i > 0 && !(leaf->slots()[i - 1] < obj)) return false;
+                if ((low && obj < *low) || (high && !(obj < *high))) return false;
+            }
+            last = leaf;
+            objNum += leaf->count;
+            leafNum++;
+            return true;
+        }
+
+        const Inner_ *inner = static_cast<const Inner_ *>(node);
+        if (inner->count > INNER_CAP || inner->count < (level == 1 ? 1 : INNER_MIN)) return false;
+        for (int i = 0; i <= inner->count; i++) {
+            const int *l = i > 0 ? inner->keys() + i - 1 : low;
+            const int *h = i < inner->count ? inner->keys() + i : high;
+            if (l && h && !(*l < *h)) return false;
+            if (!_check_node(inner->children[i], level + 1, l, h, last, objNum, leafNum)) return false;
+        }
+        return true;
+    }
+};
+
+static bool is_valid_view(const BTreeView &view) {
+    return view.is_valid();
+}
+
+static void test_random_op() {
+    BTreeView view;
+    test::test_random_set_op(view, 3000, 100000, 2, is_valid_view);
+
+    dstruct::BTreeSet<int> set;
+    test::test_random_set_op(set, 3000, 100000, 2, is_sorted_unique<dstruct::BTreeSet<int>>);
+}
+
+// sequential push: every leaf but the last has LEAF_MIN objs, every inner node but the rightmost has INNER_MIN keys
+static void build_sequential(BTreeView &view, int n) {
+    for (int i = 0; i < n; i++) view.push(i * 10);
+    DSTRUCT_ASSERT(view.height() >= 4 && view.is_valid());
+}
+
+// the first leaf parent from key: has both siblings, all half full
+static BTreeView::Family find_half_full_family(const BTreeView &view, int key) {
+    while (true) {
+        auto f = view.family(key);
+        if (f.leftCount == BTreeView::INNER_MIN && f.count == BTreeView::INNER_MIN &&
+            f.rightCount == BTreeView::INNER_MIN) return f;
+        key += 10;
+    }
+}
+
+// pop the min obj of P: its first leaf merges with the next one, P is under half full
+static void test_inner_rebalance() {
+    BTreeView view;
+    const int n = 2000;
+    build_sequential(view, n);
+    int num = n;
+
+    { // borrow the last child of left sibling
+        auto f = find_half_full_family(view, 3000);
+        for (int i = 1; i <= 6; i++) view.push(f.low - i); // split the last leaf of left
+        num += 6;
+        DSTRUCT_ASSERT(view.family(f.low).leftCount == BTreeView::INNER_MIN + 1);
+
+        view.pop(f.low);
+        num--;
+        auto after = view.family(f.high - 10);
+        DSTRUCT_ASSERT(after.index == f.index && after.grandCount == f.grandCount);
+        DSTRUCT_ASSERT(after.count == BTreeView::INNER_MIN && after.leftCount == BTreeView::INNER_MIN);
+        DSTRUCT_ASSERT(view.is_valid() && static_cast<int>(view.size()) == num);
+        DSTRUCT_ASSERT(!view.contains(f.low) && view.contains(f.low - 6) && view.contains(f.low + 10));
+    }
+
+    { // borrow the first child of right sibling
+        auto f = find_half_full_family(view, 8000);
+        for (int i = 1; i <= 6; i++) view.push(f.high + i); // split the first leaf of right
+        num += 6;
+        DSTRUCT_ASSERT(view.family(f.low).rightCount == BTreeView::INNER_MIN + 1);
+
+        view.pop(f.low);
+        num--;
+        auto after = view.family(f.low + 10);
+        DSTRUCT_ASSERT(after.index == f.index && after.grandCount == f.grandCount);
+        DSTRUCT_ASSERT(after.count == BTreeView::INNER_MIN && after.rightCount == BTreeView::INNER_MIN);
+        DSTRUCT_ASSERT(view.is_valid() && static_cast<int>(view.size()) == num);
+        DSTRUCT_ASSERT(!view.contains(f.low) && view.contains(f.high + 6) && view.contains(f.high - 10));
+    }
+
+    { // both siblings half full: merge with left sibling
+        auto f = find_half_full_family(view, 14000);
+        view.pop(f.low);
+        num--;
+        DSTRUCT_ASSERT(view.family(f.low + 10).count == 2 * BTreeView::INNER_MIN);
+        DSTRUCT_ASSERT(view.is_valid() && static_cast<int>(view.size()) == num);
+        DSTRUCT_ASSERT(!view.contains(f.low) && view.contains(f.low - 10) && view.contains(f.low + 10));
+    }
+
+    // merge up to root: pop all
+    for (int i = n * 10; i >= 0; i--) view.pop(i);
+    DSTRUCT_ASSERT(view.empty() && view.is_valid());
+}
+
+// erase(it) return the next obj, the leaf of it is merged with a sibling
+static void test_erase_across_merge() {
+    BTreeView view;
+    const int n = 2000;
+    build_sequential(view, n);
+
+    { // the first leaf of P absorb the second one
+        auto f = find_half_full_family(view, 3000);
+        auto capacity = view.capacity();
+        auto it = view.erase(view.find(f.low + 40)); // the last obj of the first leaf
+        DSTRUCT_ASSERT(view.capacity() == capacity - BTreeView::LEAF_CAP);
+        DSTRUCT_ASSERT(it != view.end() && *it == f.low + 50);
+        for (int i = 0; i < 10; i++, it++) DSTRUCT_ASSERT(*it == f.low + 50 + i * 10);
+    }
+
+    { // the second leaf of P is merged to the first one
+        auto f = find_half_full_family(view, 8000);
+        auto capacity = view.capacity();
+        auto it = view.erase(view.find(f.low + 90)); // the last obj of the second leaf
+        DSTRUCT_ASSERT(view.capacity() == capacity - BTreeView::LEAF_CAP);
+        DSTRUCT_ASSERT(it != view.end() && *it == f.low + 100);
+        for (int i = 0; i < 10; i++, it++) DSTRUCT_ASSERT(*it == f.low + 100 + i * 10);
+    }
+
+    DSTRUCT_ASSERT(view.is_valid() && static_cast<int>(view.size()) == n - 2);
+
+    // erase the last obj: end
+    DSTRUCT_ASSERT(view.erase(view.find((n - 1) * 10)) == view.end());
+}
+
+// BasicString haven't operator<
+struct StrLess {
+    bool operator()(const dstruct::String &s1, const dstruct::String &s2) const {
+        for (int i = 0; i < static_cast<int>(s1.size()) && i < static_cast<int>(s2.size()); i++) {
+            if (s1[i] != s2[i]) return s1[i] < s2[i];
+        }
+        return s1.size() < s2.size();
+    }
+};
+
+static void test_btree_map() {
+    dstruct::BTreeMap<dstruct::String, int, StrLess> wordCount;
+
+    const char *words[] = { "map", "set", "heap", "map", "tree", "map", "set" };
+    for (auto word : words) {
+        wordCount[word]++;
+    }
+    DSTRUCT_ASSERT(wordCount.size() == 4);
+    DSTRUCT_ASSERT(wordCount["map"] == 3 && wordCount["set"] == 2 && wordCount["heap"] == 1);
+
+    // sorted by key
+    const char *sortedWords[] = { "heap", "map", "set", "tree" };
+    int index = 0;
+    for (auto &kv : wordCount) DSTRUCT_ASSERT(kv.key == sortedWords[index++]);
+
+    wordCount.push({ "queue", 5 });
+    wordCount.pop("tree");
+    DSTRUCT_ASSERT(wordCount.find("tree") == wordCount.end());
+    DSTRUCT_ASSERT(wordCount.find("queue")->value == 5 && wordCount.size() == 4);
+
+    auto result = wordCount.try_emplace("heap", 100);
+    DSTRUCT_ASSERT(!result.inserted && result.it->value == 1);
+    result = wordCount.insert_or_assign("heap", 100);
+    DSTRUCT_ASSERT(!result.inserted && wordCount["heap"] == 100);
+
+    const dstruct::BTreeMap<dstruct::String, int, StrLess> &constMap = wordCount;
+    DSTRUCT_ASSERT(constMap["queue"] == 5);
+
+    wordCount.clear();
+    DSTRUCT_ASSERT(wordCount.empty());
+
+    // non-trivial value moves between nodes
+    dstruct::BTreeMap<int, dstruct::String, dstruct::less<int>, dstruct::Alloc, 128> intToStr;
+    char buff[16];
+    for (int i = 0; i < 2000; i++) {
+        int key = (i * 37) % 2000;
+        for (int j = 0; j < 10; j++) buff[j] = 'a' + (key + j) % 26;
+        buff[10] = '\0';
+        intToStr.try_emplace(key, buff);
+    }
+    for (int i = 0; i < 2000; i += 3) intToStr.pop(i);
+    int lastKey = -1;
+    for (auto &kv : intToStr) {
+        DSTRUCT_ASSERT(kv.key > lastKey && kv.key % 3 != 0);
+        DSTRUCT_ASSERT(kv.value.size() == 10 && kv.value[0] == 'a' + kv.key % 26);
+        lastKey = kv.key;
+    }
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_btree_set();
+    test_random_op();
+    test_inner_rebalance();
+    test_erase_across_merge();
+    test_btree_map();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+#include <thread>
+
+#include <dstruct.hpp>
+
+#define MEM_512K_BYTE 512 * 1024
+
+using ConcurrentSMA = dstruct::ConcurrentMemAllocator<dstruct::StaticMemAllocator<MEM_512K_BYTE>>;
+using ConcurrentBTSMA = dstruct::ConcurrentMemAllocator<dstruct::BoundaryTagMemAllocator<MEM_512K_BYTE>>;
+
+// every thread: random allocate/deallocate, fill mem-block with thread id and check it
+template <typename SMA>
+static void stress_test(int threadId) {
+    const int slotNum = 64, opNum = 100000;
+    dstruct::Array<unsigned char *, slotNum> memArr(nullptr);
+    dstruct::Array<int, slotNum> sizeArr(0);
+    unsigned int seed = threadId + 1;
+
+    for (int i = 0; i < opNum; i++) {
+        seed = seed * 1103515245 + 12345;
+        int slot = (seed >> 16) % slotNum;
+        if (memArr[slot] != nullptr) {
+            for (int j = 0; j < sizeArr[slot]; j++) {
+                DSTRUCT_ASSERT(memArr[slot][j] == threadId);
+            }
+            DSTRUCT_ASSERT(SMA::deallocate(memArr[slot], sizeArr[slot]) == true);
+            memArr[slot] = nullptr;
+        } else {
+            // 1/8: big block, skip thread cache
+            sizeArr[slot] = (seed >> 8) % 8 == 0 ? 129 + (seed >> 4) % 512 : 1 + (seed >> 4) % 128;
+            memArr[slot] = static_cast<unsigned char *>(SMA::allocate(sizeArr[slot]));
+            DSTRUCT_ASSERT(memArr[slot] != nullptr);
+            for (int j = 0; j < sizeArr[slot]; j++) {
+                memArr[slot][j] = threadId;
+            }
+        }
+    }
+
+    for (int i = 0; i < slotNum; i++) {
+        if (memArr[i] != nullptr) SMA::deallocate(memArr[i], sizeArr[i]);
+    }
+}
+
+template <typename SMA>
+static void test_concurrent_sma() {
+    int freeMemSize = SMA::free_mem_size();
+
+    dstruct::Vector<std::thread *> threads;
+    for (int i = 0; i < 8; i++) {
+        threads.push_back(new std::thread(stress_test<SMA>, i));
+    }
+
+    for (auto t : threads) {
+        t->join();
+        delete t;
+    }
+
+    // thread cache is given back when thread exit
+    SMA::memory_merge();
+    SMA::dump();
+    DSTRUCT_ASSERT(SMA::free_mem_size() == freeMemSize);
+
+    // thread cache of current thread
+    void *memPtr = SMA::allocate(8);
+    DSTRUCT_ASSERT(SMA::free_mem_size() < freeMemSize);
+    SMA::deallocate(memPtr, 8);
+    SMA::flush();
+    DSTRUCT_ASSERT(SMA::free_mem_size() == freeMemSize);
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_concurrent_sma<ConcurrentSMA>();
+    test_concurrent_sma<ConcurrentBTSMA>();
+
+    // use with data structures
+    {
+        dstruct::Vector<int, ConcurrentSMA> vec;
+        for (int i = 0; i < 100; i++) vec.push_back(i);
+        DSTRUCT_ASSERT(vec.back() == 99);
+    }
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
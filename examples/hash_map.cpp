@@ -0,0 +1,132 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+
+#include <dstruct.hpp>
+#include <TestBase.hpp>
+
+static void test_hash_set() {
+    dstruct::HashSet<int> set;
+    DSTRUCT_ASSERT(set.empty() && set.find(1) == set.end() && set.begin() == set.end());
+
+    for (int i = 0; i < 1000; i++) set.push(i * 7);
+    set.push(0); // exist
+    DSTRUCT_ASSERT(set.size() == 1000);
+    DSTRUCT_ASSERT(set.load_factor() <= set.max_load_factor());
+
+    for (int i = 0; i < 7000; i++) {
+        DSTRUCT_ASSERT(set.contains(i) == (i % 7 == 0));
+    }
+
+    long long sum = 0;
+    int num = 0;
+    for (int obj : set) { sum += obj; num++; }
+    DSTRUCT_ASSERT(num == 1000 && sum == 7LL * 999 * 1000 / 2);
+
+    // erase while iterating: remove odd
+    for (auto it = set.begin(); it != set.end(); ) {
+        if (*it % 2) it = set.erase(it);
+        else it++;
+    }
+    DSTRUCT_ASSERT(set.size() == 500);
+    for (int i = 0; i < 1000; i++) {
+        DSTRUCT_ASSERT(set.contains(i * 7) == (i % 2 == 0));
+    }
+
+    set.pop(0);
+    set.pop(1); // not exist
+    DSTRUCT_ASSERT(set.size() == 499 && !set.contains(0));
+
+    // copy / move
+    dstruct::HashSet<int> copySet(set);
+    dstruct::HashSet<int> moveSet(dstruct::move(set));
+    DSTRUCT_ASSERT(set.empty() && set.find(14) == set.end());
+    DSTRUCT_ASSERT(copySet.size() == 499 && moveSet.size() == 499 && copySet.contains(14) && moveSet.contains(14));
+
+    copySet.clear();
+    DSTRUCT_ASSERT(copySet.empty() && copySet.begin() == copySet.end());
+    copySet.push(3);
+    DSTRUCT_ASSERT(copySet.size() == 1 && *copySet.begin() == 3);
+}
+
+// random push/pop at a high load factor, check with a brute-force table
+static void test_random_op() {
+    dstruct::HashSet<unsigned int> set;
+    set.max_load_factor(0.95f);
+    test::test_random_set_op(set, 5000, 200000);
+}
+
+// clustered keys, the hash of int is mixed in the table
+static void test_bad_keys() {
+    dstruct::HashSet<unsigned long long> set;
+    set.reserve(20000);
+    unsigned long long capacity = set.capacity();
+    for (unsigned long long i = 0; i < 20000; i++) set.push(i << 32);
+    DSTRUCT_ASSERT(set.capacity() == capacity && set.size() == 20000);
+    for (unsigned long long i = 0; i < 20000; i++) DSTRUCT_ASSERT(set.contains(i << 32));
+}
+
+static void test_hash_map() {
+    dstruct::HashMap<dstruct::String, int> wordCount;
+
+    const char *words[] = { "map", "set", "heap", "map", "tree", "map", "set" };
+    for (auto word : words) {
+        wordCount[word]++;
+    }
+    DSTRUCT_ASSERT(wordCount.size() == 4);
+    DSTRUCT_ASSERT(wordCount["map"] == 3 && wordCount["set"] == 2 && wordCount["heap"] == 1);
+
+    wordCount.push({ "queue", 5 });
+    wordCount.pop("tree");
+    DSTRUCT_ASSERT(wordCount.find("tree") == wordCount.end());
+    DSTRUCT_ASSERT(wordCount.find("queue")->value == 5 && wordCount.size() == 4);
+
+    int sum = 0;
+    for (auto &kv : wordCount) sum += kv.value;
+    DSTRUCT_ASSERT(sum == 3 + 2 + 1 + 5);
+
+    const dstruct::HashMap<dstruct::String, int> &constMap = wordCount;
+    DSTRUCT_ASSERT(constMap["heap"] == 1);
+
+    // only once lookup
+    auto result = wordCount.try_emplace("heap", 100);
+    DSTRUCT_ASSERT(!result.inserted && result.it->value == 1);
+    result = wordCount.insert_or_assign("heap", 100);
+    DSTRUCT_ASSERT(!result.inserted && wordCount["heap"] == 100);
+    result = wordCount.find_or_insert("list");
+    DSTRUCT_ASSERT(result.inserted && result.it->value == 0 && wordCount.size() == 5);
+    result = wordCount.try_emplace("deque", 7);
+    DSTRUCT_ASSERT(result.inserted && wordCount.find("deque")->value == 7);
+
+    wordCount.clear();
+    DSTRUCT_ASSERT(wordCount.empty());
+
+    // aggregate with growing
+    dstruct::HashMap<int, int> counter;
+    for (int i = 0; i < 30000; i++) {
+        counter[i % 5000]++;
+    }
+    DSTRUCT_ASSERT(counter.size() == 5000);
+    for (auto &kv : counter) DSTRUCT_ASSERT(kv.value == 6);
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_hash_set();
+    test_random_op();
+    test_bad_keys();
+    test_hash_map();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
@@ -12,6 +12,105 @@
 #include <dstruct.hpp>
 
 
+template <typename HeapType>
+static void test_heap_order(HeapType &heap, int n) {
+    unsigned int seed = 2023;
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1103515245 + 12345;
+        heap.push((seed >> 8) % 1000); // with duplicates
+    }
+    DSTRUCT_ASSERT(heap.size() == static_cast<size_t>(n));
+
+    int prev = -1;
+    while (!heap.empty()) {
+        int val = heap.top(); heap.pop();
+        DSTRUCT_ASSERT(prev <= val);
+        prev = val;
+    }
+}
+
+struct FirstCharGreater {
+    bool operator()(const dstruct::String &s1, const dstruct::String &s2) const {
+        return s1[0] > s2[0];
+    }
+};
+
+// count default construct and copy, move is free
+struct Event {
+    static int defaultCnt, copyCnt;
+    int time;
+
+    Event() : time { 0 } { defaultCnt++; }
+    Event(int t) : time { t } { }
+    Event(const Event &e) : time { e.time } { copyCnt++; }
+    Event(Event &&e) : time { e.time } { }
+    Event & operator=(const Event &e) { time = e.time; copyCnt++; return *this; }
+    Event & operator=(Event &&e) { time = e.time; return *this; }
+
+    bool operator<(const Event &e) const { return time < e.time; }
+};
+
+int Event::defaultCnt = 0;
+int Event::copyCnt = 0;
+
+static void test_no_copy() {
+    dstruct::DAryHeap<Event, 4> heap;
+    dstruct::MinHeap<Event> binaryHeap;
+    DSTRUCT_ASSERT(Event::defaultCnt == 0); // no obj for padding
+
+    unsigned int seed = 2023;
+    for (int i = 0; i < 1000; i++) {
+        seed = seed * 1103515245 + 12345;
+        heap.push(Event((seed >> 8) % 1000));
+        binaryHeap.push(Event((seed >> 8) % 1000));
+    }
+
+    int prev = -1;
+    while (!heap.empty()) {
+        DSTRUCT_ASSERT(prev <= heap[1].time && heap[1].time == binaryHeap[1].time);
+        prev = heap[1].time;
+        heap.pop();
+        binaryHeap.pop();
+    }
+
+    DSTRUCT_ASSERT(binaryHeap.empty());
+    DSTRUCT_ASSERT(Event::defaultCnt == 0 && Event::copyCnt == 0);
+}
+
+static void test_d_ary_heap() {
+    dstruct::DAryHeap<int> quadHeap;
+    dstruct::DAryHeap<int, 3> triHeap;
+    dstruct::Heap<int, dstruct::less<int>, dstruct::Alloc, dstruct::Vector<int>, 8> octHeap;
+
+    test_heap_order(quadHeap, 1000);
+    test_heap_order(triHeap, 1000);
+    test_heap_order(octHeap, 1000);
+    test_heap_order(quadHeap, 1); // reuse
+
+    // storage is skewed by 3 virtual padding before top, a children group never cross lines
+    for (int i = 0; i < 100; i++) quadHeap.push(i);
+    DSTRUCT_ASSERT((reinterpret_cast<size_t>(&quadHeap[1]) - 3 * sizeof(int)) % DSTRUCT_CACHE_LINE_SIZE == 0);
+    DSTRUCT_ASSERT(reinterpret_cast<size_t>(&quadHeap[2]) % (4 * sizeof(int)) == 0);
+
+    // bulk load + heapify
+    int data[] = { 5, 3, 9, 1, 7, 2, 8 };
+    dstruct::MaxHeap<int> maxHeap(data, data + 7);
+    for (int i : { 9, 8, 7, 5, 3, 2, 1 }) {
+        DSTRUCT_ASSERT(maxHeap.top() == i);
+        maxHeap.pop();
+    }
+
+    // move-only sift: non-trivial type
+    dstruct::DAryHeap<dstruct::String, 4, FirstCharGreater> strHeap;
+    strHeap.push(dstruct::String("b-string-without-sso"));
+    strHeap.push(dstruct::String("d-string-without-sso"));
+    strHeap.push(dstruct::String("a-string-without-sso"));
+    strHeap.push(dstruct::String("c-string-without-sso"));
+    DSTRUCT_ASSERT(strHeap.top() == "d-string-without-sso");
+    strHeap.pop(); strHeap.pop();
+    DSTRUCT_ASSERT(strHeap.size() == 2 && strHeap.top() == "b-string-without-sso");
+}
+
 int main() {
 
     std::cout << "\nTesting: " << __FILE__;
@@ -39,6 +138,9 @@ int main() {
     DSTRUCT_ASSERT(minHeap.empty());
     DSTRUCT_ASSERT(minHeap.empty());
 
+    test_d_ary_heap();
+    test_no_copy();
+
     std::cout << "   pass" << std::endl;
 
     return 0;
@@ -0,0 +1,162 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+
+#include <dstruct.hpp>
+#include <TestBase.hpp>
+
+static void test_base_op() {
+    dstruct::IndexedPriorityQueue<int> minHeap;
+
+    int h5 = minHeap.push(5);
+    int h3 = minHeap.push(3);
+    int h8 = minHeap.push(8);
+    DSTRUCT_ASSERT(minHeap.size() == 3 && minHeap.top() == 3 && minHeap.top_handle() == h3);
+
+    minHeap.update(h8, 1); // decrease-key
+    DSTRUCT_ASSERT(minHeap.top() == 1 && minHeap.top_handle() == h8);
+    minHeap.update(h8, 9); // increase-key
+    DSTRUCT_ASSERT(minHeap.top() == 3 && minHeap[h8] == 9);
+
+    minHeap.erase(h3);
+    DSTRUCT_ASSERT(!minHeap.contains(h3) && minHeap.top() == 5);
+
+    int h2 = minHeap.push(2); // reuse erased handle
+    DSTRUCT_ASSERT(h2 == h3 && minHeap.top() == 2);
+
+    minHeap.pop(); minHeap.pop();
+    DSTRUCT_ASSERT(minHeap.size() == 1 && minHeap.top() == 9 && !minHeap.contains(h5));
+    minHeap.pop();
+    DSTRUCT_ASSERT(minHeap.empty());
+}
+
+struct ShorterFirst {
+    bool operator()(const dstruct::String &s1, const dstruct::String &s2) const {
+        return s1.size() < s2.size();
+    }
+};
+
+// non-trivial type, entries are moved by sift
+static void test_string() {
+    dstruct::IndexedHeap<dstruct::String, ShorterFirst> strHeap;
+
+    int hLong = strHeap.push(dstruct::String("a-long-string-without-sso"));
+    strHeap.push(dstruct::String("a-longer-string-without-sso"));
+    int hShort = strHeap.push(dstruct::String("short"));
+    DSTRUCT_ASSERT(strHeap.top() == "short");
+
+    strHeap.update(hShort, dstruct::String("the-longest-string-without-sso"));
+    DSTRUCT_ASSERT(strHeap.top_handle() == hLong);
+    strHeap.erase(hLong);
+    DSTRUCT_ASSERT(strHeap.top() == "a-longer-string-without-sso" && strHeap.size() == 2);
+}
+
+// random push/update/erase/pop, check with a brute-force table
+static void test_random_op() {
+    dstruct::IndexedHeap<int, dstruct::greater<int>> maxHeap;
+    dstruct::Vector<int> values; // handle -> value, -1: not in heap
+    test::Random random;
+
+    for (int i = 0; i < 20000; i++) {
+        unsigned int seed = random.next();
+        int op = (seed >> 16) % 4;
+        int val = (seed >> 4) % 1000;
+
+        if (op <= 1 || maxHeap.empty()) {
+            int handle = maxHeap.push(val);
+            if (handle == static_cast<int>(values.size())) values.push_back(-1);
+            DSTRUCT_ASSERT(values[handle] == -1);
+            values[handle] = val;
+        } else {
+            int handle = (seed >> 20) % values.size();
+            if (!maxHeap.contains(handle)) {
+                DSTRUCT_ASSERT(values[handle] == -1);
+            } else if (op == 2) {
+                maxHeap.update(handle, val);
+                values[handle] = val;
+            } else {
+                maxHeap.erase(handle);
+                values[handle] = -1;
+            }
+        }
+
+        if (i % 7 == 0 && !maxHeap.empty()) {
+            values[maxHeap.top_handle()] = -1;
+            maxHeap.pop();
+        }
+
+        int maxVal = -1, num = 0;
+        for (int v : values) {
+            if (v >= 0) num++;
+            if (v > maxVal) maxVal = v;
+        }
+        DSTRUCT_ASSERT(static_cast<int>(maxHeap.size()) == num);
+        DSTRUCT_ASSERT(maxHeap.empty() || maxHeap.top() == maxVal);
+    }
+}
+
+// shortest path with decrease-key, no duplicate entries
+static void test_dijkstra() {
+    struct Edge { int to, weight; };
+    const int vertexNum = 6;
+    dstruct::Vector<dstruct::Vector<Edge>> graph;
+    for (int i = 0; i < vertexNum; i++) graph.push_back(dstruct::Vector<Edge>());
+
+    auto add_edge = [&](int from, int to, int weight) {
+        graph[from].push_back(Edge { to, weight });
+        graph[to].push_back(Edge { from, weight });
+    };
+    add_edge(0, 1, 7); add_edge(0, 2, 9); add_edge(0, 5, 14);
+    add_edge(1, 2, 10); add_edge(1, 3, 15); add_edge(2, 3, 11);
+    add_edge(2, 5, 2); add_edge(3, 4, 6); add_edge(4, 5, 9);
+
+    dstruct::IndexedPriorityQueue<int> queue;
+    dstruct::Vector<int> dist(vertexNum, 1 << 30), handles(vertexNum, -1), vertexOf(vertexNum, -1);
+    int maxQueueSize = 0;
+
+    dist[0] = 0;
+    handles[0] = queue.push(0);
+    vertexOf[handles[0]] = 0;
+    while (!queue.empty()) {
+        int u = vertexOf[queue.top_handle()];
+        queue.pop();
+        for (auto &e : graph[u]) {
+            if (dist[u] + e.weight >= dist[e.to]) continue;
+            dist[e.to] = dist[u] + e.weight;
+            if (queue.contains(handles[e.to]) && vertexOf[handles[e.to]] == e.to) {
+                queue.update(handles[e.to], dist[e.to]);
+            } else {
+                handles[e.to] = queue.push(dist[e.to]);
+                vertexOf[handles[e.to]] = e.to;
+            }
+        }
+        if (static_cast<int>(queue.size()) > maxQueueSize) maxQueueSize = queue.size();
+    }
+
+    int expected[] = { 0, 7, 9, 20, 20, 11 };
+    for (int i = 0; i < vertexNum; i++) {
+        DSTRUCT_ASSERT(dist[i] == expected[i]);
+    }
+    DSTRUCT_ASSERT(maxQueueSize < vertexNum);
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_base_op();
+    test_string();
+    test_random_op();
+    test_dijkstra();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
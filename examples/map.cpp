@@ -11,6 +11,36 @@
 
 #include <dstruct.hpp>
 
+// count the default constructions of the value
+struct Value {
+    static int defaultCnt;
+    int data;
+    Value() : data { 0 } { defaultCnt++; }
+    Value(int _data) : data { _data } { }
+};
+
+int Value::defaultCnt = 0;
+
+// find/pop look up by the key only, the value isn't default-constructed
+template <typename MapType>
+static void test_lookup_by_key() {
+    MapType map;
+    for (int i = 0; i < 100; i++) map.push({ i, Value(i) });
+
+    Value::defaultCnt = 0;
+    for (int i = 0; i < 200; i++) {
+        auto it = map.find(i);
+        DSTRUCT_ASSERT((it == map.end()) == (i >= 100));
+        if (i < 100) DSTRUCT_ASSERT(it->value.data == i);
+    }
+    const MapType &constMap = map;
+    DSTRUCT_ASSERT(constMap.find(50) != constMap.end());
+    for (int i = 0; i < 100; i += 2) map.pop(i);
+    DSTRUCT_ASSERT(map.size() == 50);
+    DSTRUCT_ASSERT(map.find(2) == map.end() && map.find(3)->value.data == 3);
+    DSTRUCT_ASSERT(Value::defaultCnt == 0);
+}
+
 
 int main() {
 
@@ -48,6 +78,46 @@ int main() {
 
     DSTRUCT_ASSERT(charToIntMapTable.empty());
 
+    // find_or_insert / try_emplace / insert_or_assign: only once lookup
+    dstruct::Map<int, dstruct::String> intToStrMapTable;
+
+    auto result = intToStrMapTable.try_emplace(1, "one");
+    DSTRUCT_ASSERT(result.inserted && result.it->value == "one");
+    result = intToStrMapTable.try_emplace(1, "uno"); // exist, not changed
+    DSTRUCT_ASSERT(!result.inserted && result.it->value == "one");
+
+    result = intToStrMapTable.insert_or_assign(1, dstruct::String("uno"));
+    DSTRUCT_ASSERT(!result.inserted && intToStrMapTable[1] == "uno");
+    result = intToStrMapTable.insert_or_assign(2, dstruct::String("two"));
+    DSTRUCT_ASSERT(result.inserted && intToStrMapTable[2] == "two");
+
+    result = intToStrMapTable.find_or_insert(3);
+    DSTRUCT_ASSERT(result.inserted && result.it->value.size() == 0);
+    result = intToStrMapTable.find_or_insert(2);
+    DSTRUCT_ASSERT(!result.inserted && result.it->value == "two");
+    DSTRUCT_ASSERT(intToStrMapTable.size() == 3);
+
+    // keep balanced and sorted: shuffled keys by operator[]
+    dstruct::Map<int, int> counter;
+    for (int i = 0; i < 3000; i++) {
+        counter[(i * 7919) % 1000]++;
+    }
+    DSTRUCT_ASSERT(counter.size() == 1000);
+    int lastKey = -1;
+    for (auto kv : counter) {
+        DSTRUCT_ASSERT(kv.key == lastKey + 1 && kv.value == 3);
+        lastKey = kv.key;
+    }
+    for (int i = 0; i < 1000; i += 2) counter.pop(i);
+    for (int i = 0; i < 1000; i++) {
+        DSTRUCT_ASSERT((counter.find(i) == counter.end()) == (i % 2 == 0));
+    }
+
+    test_lookup_by_key<dstruct::Map<int, Value>>();
+    test_lookup_by_key<dstruct::HashMap<int, Value>>();
+    test_lookup_by_key<dstruct::BTreeMap<int, Value>>();
+    test_lookup_by_key<dstruct::RBTreeMap<int, Value>>();
+
     std::cout << "   pass" << std::endl;
 
     return 0;
@@ -0,0 +1,76 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+
+#include <dstruct.hpp>
+
+#define MEM_512K_BYTE 512 * 1024
+
+using UpstreamSMA = dstruct::BoundaryTagMemAllocator<MEM_512K_BYTE>;
+
+template <typename Upstream>
+static void test_monotonic_allocator() {
+    dstruct::MonotonicAllocator<Upstream, 1024> mAlloc;
+
+    DSTRUCT_ASSERT(mAlloc.chunk_mem_size() == 0);
+
+    { // temporary dstructs, node by node from chunks
+        dstruct::SLinkedList<int, decltype(mAlloc)> slist(mAlloc);
+        dstruct::BSTree<int, decltype(mAlloc)> bst(mAlloc);
+        dstruct::AVLTree<int, dstruct::less<int>, decltype(mAlloc)> avl(mAlloc);
+
+        for (int i = 0; i < 1000; i++) {
+            int key = (i * 7919) % 1000; // no dup
+            slist.push_back(i);
+            bst.push(key);
+            avl.push(key);
+        }
+
+        int expect = 0;
+        for (auto val : avl) {
+            DSTRUCT_ASSERT(val == expect);
+            expect++;
+        }
+        DSTRUCT_ASSERT(bst.size() == 1000 && slist.size() == 1000 && slist.back() == 999);
+
+        avl.pop(500); // deallocate is no-op
+        DSTRUCT_ASSERT(avl.find(500) == avl.end());
+    }
+
+    DSTRUCT_ASSERT(mAlloc.chunk_mem_size() > 1000 * 3 * static_cast<int>(sizeof(int)));
+
+    // alignment and big block(exclusive chunk)
+    void *ptr = mAlloc.allocate(3);
+    DSTRUCT_ASSERT(reinterpret_cast<dstruct::ptr_t>(ptr) % 8 == 0);
+    DSTRUCT_ASSERT(mAlloc.allocate(64 * 1024) != nullptr);
+    DSTRUCT_ASSERT(mAlloc.allocate(0) == nullptr);
+
+    mAlloc.release();
+    DSTRUCT_ASSERT(mAlloc.chunk_mem_size() == 0 && mAlloc.free_mem_size() == 0);
+
+    // reuse after release
+    DSTRUCT_ASSERT(mAlloc.allocate(16) != nullptr);
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_monotonic_allocator<dstruct::Alloc>();
+
+    int freeMemSize = UpstreamSMA::free_mem_size();
+    test_monotonic_allocator<UpstreamSMA>();
+    // all chunks give back to upstream
+    DSTRUCT_ASSERT(UpstreamSMA::free_mem_size() == freeMemSize);
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
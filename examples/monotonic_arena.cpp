@@ -0,0 +1,95 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+
+#include <dstruct.hpp>
+
+#define MEM_64K_BYTE 64 * 1024
+
+using Arena = dstruct::MonotonicArena<MEM_64K_BYTE>;
+
+template <typename K, typename V>
+using ArenaMap = dstruct::Map<K, V, dstruct::less<K>,
+    dstruct::AVLTree<
+        dstruct::KeyValue<const K, V>,
+        dstruct::KVCMPKey<dstruct::KeyValue<const K, V>, dstruct::less<K>>,
+        Arena
+    >
+>;
+
+// per-request dstruct: all memory from the arena, released in O(1)
+static void handle_request(Arena &arena, int id) {
+    dstruct::Vector<int, Arena> vec(arena);
+    dstruct::DoublyLinkedList<int, Arena> list(arena);
+    dstruct::AVLTree<int, dstruct::less<int>, Arena> avl(arena);
+    dstruct::Deque<int, 32, Arena> deque(arena);
+    ArenaMap<int, int> map(arena);
+
+    for (int i = 0; i < 100; i++) {
+        vec.push_back(i + id);
+        list.push_back(i + id);
+        avl.push(i + id);
+        deque.push_front(i + id);
+        map[i] = i + id;
+    }
+
+    DSTRUCT_ASSERT(arena.used_mem_size() > 0);
+
+    int i = 0;
+    for (auto val : list) {
+        DSTRUCT_ASSERT(val == vec[i] && map[i] == val);
+        DSTRUCT_ASSERT(deque[99 - i] == val);
+        i++;
+    }
+    DSTRUCT_ASSERT(avl.size() == 100 && *(avl.begin()) == id);
+
+    // copy: use the same arena
+    auto vecCopy = vec;
+    DSTRUCT_ASSERT(vecCopy.size() == vec.size() && vecCopy[-1] == vec[-1]);
+
+    // move: take over memory and arena
+    auto dequeMove = dstruct::move(deque);
+    DSTRUCT_ASSERT(deque.empty() && dequeMove.size() == 100);
+    DSTRUCT_ASSERT(dequeMove.back() == id);
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    Arena arena;
+
+    // don't use dstruct::Alloc(port) when pass arena
+    for (int id = 0; id < 10; id++) {
+        handle_request(arena, id);
+        arena.release();
+        DSTRUCT_ASSERT(arena.used_mem_size() == 0);
+    }
+
+    // exhausted: allocate return nullptr
+    DSTRUCT_ASSERT(arena.allocate(MEM_64K_BYTE + 8) == nullptr);
+
+    // only roll back the last mem-block
+    void *a = arena.allocate(10);
+    void *b = arena.allocate(20);
+    arena.deallocate(a, 10);
+    DSTRUCT_ASSERT(arena.used_mem_size() == 16 + 24);
+    arena.deallocate(b, 20);
+    DSTRUCT_ASSERT(arena.used_mem_size() == 16);
+    arena.release();
+
+    // static Alloc: no size overhead
+    DSTRUCT_ASSERT(sizeof(dstruct::Vector<int>) == 3 * sizeof(dstruct::size_t));
+    DSTRUCT_ASSERT(sizeof(dstruct::Vector<int, Arena>) == 3 * sizeof(dstruct::size_t) + sizeof(Arena *));
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+
+#include <dstruct.hpp>
+
+template <typename HeapType>
+static void check_order(HeapType &heap, size_t n) {
+    DSTRUCT_ASSERT(heap.size() == n);
+    int prev = -1;
+    while (!heap.empty()) {
+        DSTRUCT_ASSERT(prev <= heap.top());
+        prev = heap.top();
+        heap.pop();
+    }
+}
+
+static void test_base_op() {
+    dstruct::PairingHeap<int, dstruct::less<int>> minHeap;
+    dstruct::PairingHeap<int, dstruct::greater<int>> maxHeap;
+
+    for (int i = 0; i < 10; i++) {
+        minHeap.push(i);
+        maxHeap.push(i);
+        DSTRUCT_ASSERT(minHeap.top() == 0 && maxHeap.top() == i);
+    }
+
+    for (int i = 0; i < 10; i++) {
+        DSTRUCT_ASSERT(minHeap.top() == i && maxHeap.top() == 9 - i);
+        minHeap.pop();
+        maxHeap.pop();
+    }
+    DSTRUCT_ASSERT(minHeap.empty() && maxHeap.empty());
+
+    unsigned int seed = 2023;
+    for (int i = 0; i < 10000; i++) {
+        seed = seed * 1103515245 + 12345;
+        minHeap.push((seed >> 8) % 1000);
+        if (i % 3 == 0) minHeap.pop();
+    }
+    check_order(minHeap, 10000 - 3334);
+}
+
+static void test_meld_copy_move() {
+    dstruct::PairingHeap<int, dstruct::less<int>> h1, h2;
+    for (int i = 0; i < 100; i++) {
+        (i % 2 ? h1 : h2).push(i);
+    }
+
+    h1.meld(h2);
+    DSTRUCT_ASSERT(h2.empty() && h1.size() == 100 && h1.top() == 0);
+    h2.push(-1);
+    h1.meld(h2);
+    DSTRUCT_ASSERT(h1.top() == -1);
+    h1.pop();
+
+    auto h3 = h1; // copy
+    auto h4 = dstruct::move(h1);
+    DSTRUCT_ASSERT(h1.empty() && h3.size() == 100 && h4.size() == 100);
+    for (int i = 0; i < 100; i++) {
+        DSTRUCT_ASSERT(h3.top() == i && h4.top() == i);
+        h3.pop(); h4.pop();
+    }
+
+    // clear un-popped nodes
+    for (int i = 0; i < 1000; i++) h4.push(i % 7);
+    h4.pop();
+}
+
+struct ShorterFirst {
+    bool operator()(const dstruct::String &s1, const dstruct::String &s2) const {
+        return s1.size() < s2.size();
+    }
+};
+
+static void test_pool_alloc() {
+    // node from PoolAlloc
+    dstruct::pmemory::PairingHeap<dstruct::String, ShorterFirst> strHeap;
+    strHeap.push(dstruct::String("a-longer-string-without-sso"));
+    strHeap.push(dstruct::String("a-long-string-without-sso"));
+    strHeap.push(dstruct::String("short"));
+    DSTRUCT_ASSERT(strHeap.top() == "short");
+    strHeap.pop();
+    DSTRUCT_ASSERT(strHeap.top() == "a-long-string-without-sso");
+
+    dstruct::pmemory::PairingHeap<int> h1, h2;
+    for (int i = 0; i < 1000; i++) {
+        h1.push(2 * i);
+        h2.push(2 * i + 1);
+    }
+    h1.meld(h2); // same pool
+    for (int i = 0; i < 2000; i++) {
+        DSTRUCT_ASSERT(h1.top() == i);
+        h1.pop();
+    }
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_base_op();
+    test_meld_copy_move();
+    test_pool_alloc();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
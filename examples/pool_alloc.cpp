@@ -0,0 +1,105 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+
+#include <dstruct.hpp>
+
+#define MEM_512K_BYTE 512 * 1024
+
+using Pool24 = dstruct::PoolAlloc<24, dstruct::Alloc, 1024>;
+
+static void test_pool_alloc() {
+    // LIFO reuse, no per-block header
+    void *a = Pool24::allocate(24);
+    void *b = Pool24::allocate(20);
+    DSTRUCT_ASSERT(static_cast<char *>(b) - static_cast<char *>(a) == Pool24::POOL_BLOCK_SIZE);
+    Pool24::deallocate(a, 24);
+    DSTRUCT_ASSERT(Pool24::free_block_num() == 1);
+    DSTRUCT_ASSERT(Pool24::allocate(24) == a);
+    DSTRUCT_ASSERT(Pool24::free_block_num() == 0);
+
+    // grow by slab
+    dstruct::Vector<void *> blocks;
+    for (int i = 0; i < 100; i++) {
+        blocks.push_back(Pool24::allocate(24));
+        DSTRUCT_ASSERT(reinterpret_cast<dstruct::ptr_t>(blocks.back()) % 8 == 0);
+    }
+    const int slabBlockNum = (1024 - 8) / Pool24::POOL_BLOCK_SIZE;
+    DSTRUCT_ASSERT(Pool24::slab_num() == (102 + slabBlockNum - 1) / slabBlockNum);
+    for (auto ptr : blocks) Pool24::deallocate(ptr, 24);
+    Pool24::deallocate(a, 24);
+    Pool24::deallocate(b, 24);
+    DSTRUCT_ASSERT(Pool24::free_block_num() == 102);
+
+    // big block: forward to upstream
+    void *big = Pool24::allocate(100);
+    DSTRUCT_ASSERT(big != nullptr && Pool24::free_block_num() == 102);
+    Pool24::deallocate(big, 100);
+}
+
+template <typename Upstream>
+static void test_pmemory_dstruct() {
+    dstruct::pmemory::SLinkedList<int, Upstream> slist;
+    dstruct::pmemory::DLinkedList<int, Upstream> dlist;
+    dstruct::pmemory::BSTree<int, Upstream> bst;
+    dstruct::pmemory::AVLTree<int, dstruct::less<int>, Upstream> avl;
+    dstruct::pmemory::Map<int, int, dstruct::less<int>, Upstream> map;
+    dstruct::pmemory::Deque<int, 32, Upstream> deque;
+    dstruct::pmemory::Queue<int, Upstream> queue;
+
+    for (int i = 0; i < 1000; i++) {
+        int key = (i * 7919) % 1000;
+        slist.push_back(i);
+        dlist.push_front(i);
+        bst.push(key);
+        avl.push(key);
+        map[key] = i;
+        deque.push_back(i);
+        queue.push(i);
+    }
+
+    for (int i = 0; i < 500; i++) {
+        slist.pop_front();
+        dlist.pop_back();
+        avl.pop(i);
+        map.pop(i);
+        deque.pop_front();
+        queue.pop();
+    }
+
+    DSTRUCT_ASSERT(slist.front() == 500 && dlist.back() == 500);
+    DSTRUCT_ASSERT(avl.size() == 500 && *(avl.begin()) == 500);
+    DSTRUCT_ASSERT(map.size() == 500);
+    for (int i = 0; i < 1000; i++) {
+        int key = (i * 7919) % 1000;
+        if (key >= 500) DSTRUCT_ASSERT(map[key] == i);
+    }
+    DSTRUCT_ASSERT(deque.front() == 500 && queue.front() == 500);
+    DSTRUCT_ASSERT(bst.size() == 1000);
+
+    int expect = 500;
+    for (auto val : avl) {
+        DSTRUCT_ASSERT(val == expect);
+        expect++;
+    }
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_pool_alloc();
+    test_pmemory_dstruct<dstruct::Alloc>();
+    test_pmemory_dstruct<dstruct::BoundaryTagMemAllocator<MEM_512K_BYTE>>();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
@@ -11,6 +11,55 @@
 
 #include <dstruct.hpp>
 
+struct CountAlloc {
+    static int allocateCnt;
+
+    static void * allocate(int bytes) {
+        allocateCnt++;
+        return dstruct::Alloc::allocate(bytes);
+    }
+
+    static void deallocate(void *addr, int bytes) {
+        dstruct::Alloc::deallocate(addr, bytes);
+    }
+};
+
+int CountAlloc::allocateCnt = 0;
+
+// producer/consumer: steady-state traffic shouldn't allocate
+static void test_fifo_recycle() {
+    dstruct::Queue<dstruct::String, CountAlloc> queue;
+    dstruct::String msg("fifo-message-without-sso");
+
+    int warmAllocateCnt = 0;
+    for (int i = 0; i < 100; i++) queue.push(msg);
+    for (int round = 0; round < 1000; round++) {
+        if (round == 10) warmAllocateCnt = CountAlloc::allocateCnt; // map table is stable
+        for (int i = 0; i < 50; i++) queue.push(msg);
+        for (int i = 0; i < 50; i++) queue.pop();
+    }
+    DSTRUCT_ASSERT(CountAlloc::allocateCnt == warmAllocateCnt);
+    DSTRUCT_ASSERT(queue.size() == 100 && queue.front() == msg);
+
+    // burst: grow, then drain and shrink, then grow again from spare arrays
+    for (int i = 0; i < 10000; i++) queue.push(msg);
+    while (queue.size() > 10) queue.pop();
+    int drainAllocateCnt = CountAlloc::allocateCnt;
+    dstruct::Deque<int, 8, CountAlloc> deque;
+    for (int i = 0; i < 64; i++) deque.push_front(i);
+    DSTRUCT_ASSERT(CountAlloc::allocateCnt > drainAllocateCnt);
+    for (int i = 0; i < 64; i++) {
+        DSTRUCT_ASSERT(deque[i] == 63 - i);
+    }
+
+    auto dequeCopy = deque;
+    auto dequeMove = dstruct::move(deque);
+    DSTRUCT_ASSERT(deque.empty() && dequeCopy.size() == 64 && dequeMove[-1] == 0);
+    while (!dequeMove.empty()) dequeMove.pop_back();
+    dequeMove.push_front(1);
+    DSTRUCT_ASSERT(dequeMove.front() == 1 && dequeMove.size() == 1);
+}
+
 
 int main() {
 
@@ -66,11 +115,29 @@ int main() {
         // std::cout << "pop front: " << deque.size() << " " << deque.capacity() << std::endl;
     }
 
+// random access O(1): check across array boundary / after resize
+    dstruct::Deque<int, 8> bigDeque;
+    for (int i = 0; i < 5000; i++) {
+        bigDeque.push_back(i);
+        bigDeque.push_front(-i - 1);
+    }
+    DSTRUCT_ASSERT(bigDeque.end() - bigDeque.begin() == 10000);
+    for (int i = 0; i < 10000; i++) {
+        DSTRUCT_ASSERT(bigDeque[i] == i - 5000);
+        DSTRUCT_ASSERT(*(bigDeque.begin() + i) == i - 5000);
+        DSTRUCT_ASSERT(*(bigDeque.end() - (10000 - i)) == i - 5000);
+    }
+    DSTRUCT_ASSERT(bigDeque.begin() + 10000 == bigDeque.end() && bigDeque.end() - 10000 == bigDeque.begin());
+    for (int i = 0; i < 3000; i++) bigDeque.pop_front(); // shrink map table
+    DSTRUCT_ASSERT(bigDeque[0] == -2000 && bigDeque[-1] == 4999 && bigDeque[6999] == 4999);
+
     deque.clear(); deque.push(0);
     deque.clear(); deque.push(1);
 
     DSTRUCT_ASSERT(deque.size() == 1);
 
+    test_fifo_recycle();
+
     std::cout << "   pass" << std::endl;
 
     return 0;
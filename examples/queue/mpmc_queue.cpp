@@ -0,0 +1,91 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+
+#include <dstruct.hpp>
+
+static void test_single_thread() {
+    dstruct::MPMCQueue<dstruct::String> queue(3); // round up to 4
+
+    DSTRUCT_ASSERT(queue.capacity() == 4 && queue.empty());
+    for (int i = 0; i < 4; i++) {
+        DSTRUCT_ASSERT(queue.try_push(dstruct::String("mpmc-queue-without-sso")));
+    }
+    DSTRUCT_ASSERT(!queue.try_push("full") && queue.size() == 4);
+
+    dstruct::String str;
+    DSTRUCT_ASSERT(queue.try_pop(str) && str == "mpmc-queue-without-sso");
+    queue.push(str);  // blocking, not full
+    for (int i = 0; i < 4; i++) queue.pop(str);
+    DSTRUCT_ASSERT(queue.empty() && !queue.try_pop(str));
+
+    // destroy the remaining objs by ~MPMCQueue
+    queue.push(str);
+    queue.push(str);
+
+    // instance alloc
+    dstruct::MonotonicArena<4096> arena;
+    dstruct::MPMCQueue<int, decltype(arena)> arenaQueue(16, arena);
+    DSTRUCT_ASSERT(arena.used_mem_size() > 0 && arenaQueue.try_push(1));
+}
+
+// every value is popped exactly once
+static void test_multi_thread() {
+    const int producerNum = 4, consumerNum = 4, objNum = 100000;
+    dstruct::MPMCQueue<int> queue(64);
+    static std::atomic<int> popCnt[producerNum * objNum];
+    std::atomic<long long> sum { 0 };
+
+    dstruct::Vector<std::thread *> threads;
+    for (int p = 0; p < producerNum; p++) {
+        threads.push_back(new std::thread([&queue, p] {
+            for (int i = 0; i < objNum; i++) {
+                if (i % 2) queue.push(p * objNum + i);
+                else while (!queue.try_push(p * objNum + i)) std::this_thread::yield();
+            }
+        }));
+    }
+
+    for (int c = 0; c < consumerNum; c++) {
+        threads.push_back(new std::thread([&queue, &sum] {
+            for (int i = 0; i < producerNum * objNum / consumerNum; i++) {
+                int val;
+                queue.pop(val);
+                popCnt[val]++;
+                sum += val;
+            }
+        }));
+    }
+
+    for (auto t : threads) {
+        t->join();
+        delete t;
+    }
+
+    long long n = producerNum * objNum;
+    DSTRUCT_ASSERT(queue.empty() && sum == n * (n - 1) / 2);
+    for (int i = 0; i < n; i++) {
+        DSTRUCT_ASSERT(popCnt[i] == 1);
+    }
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_single_thread();
+    test_multi_thread();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
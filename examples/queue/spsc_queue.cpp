@@ -0,0 +1,95 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+#include <thread>
+
+#include <dstruct.hpp>
+
+static void test_single_thread() {
+    dstruct::SPSCQueue<int, 8> queue;
+
+    DSTRUCT_ASSERT(queue.empty() && queue.capacity() == 8);
+    for (int i = 0; i < 8; i++) {
+        DSTRUCT_ASSERT(queue.push(i));
+    }
+    DSTRUCT_ASSERT(!queue.push(8) && queue.size() == 8); // full
+
+    int val;
+    DSTRUCT_ASSERT(queue.pop(val) && val == 0);
+    DSTRUCT_ASSERT(queue.pop() && queue.size() == 6);
+
+    // batch: wrap around the ring
+    int objs[8] = { 10, 11, 12, 13, 14, 15, 16, 17 };
+    DSTRUCT_ASSERT(queue.push_n(objs, 8) == 2 && queue.size() == 8);
+
+    int out[8];
+    DSTRUCT_ASSERT(queue.pop_n(out, 8) == 8 && queue.empty());
+    DSTRUCT_ASSERT(out[0] == 2 && out[5] == 7 && out[6] == 10 && out[7] == 11);
+    DSTRUCT_ASSERT(queue.pop_n(out, 8) == 0 && !queue.pop(val));
+
+    dstruct::SPSCQueue<dstruct::String, 4> strQueue;
+    dstruct::String str("spsc-queue-without-sso");
+    strQueue.push(str);
+    strQueue.push(dstruct::move(str));
+    dstruct::String outStr;
+    DSTRUCT_ASSERT(strQueue.pop(outStr) && outStr == "spsc-queue-without-sso");
+    DSTRUCT_ASSERT(strQueue.pop(outStr) && outStr == "spsc-queue-without-sso" && strQueue.empty());
+}
+
+// producer: push / push_n mixed, consumer: pop / pop_n mixed, check order
+static void test_producer_consumer() {
+    const int objNum = 1000000;
+    static dstruct::SPSCQueue<int, 1024> queue;
+
+    std::thread producer([&] {
+        int objs[32];
+        int next = 0;
+        while (next < objNum) {
+            if (next % 3 == 0) {
+                int n = objNum - next < 32 ? objNum - next : 32;
+                for (int i = 0; i < n; i++) objs[i] = next + i;
+                next += queue.push_n(objs, n);
+            } else if (queue.push(next)) {
+                next++;
+            }
+        }
+    });
+
+    int expected = 0;
+    int objs[16];
+    while (expected < objNum) {
+        int val;
+        if (expected % 2 == 0) {
+            int n = queue.pop_n(objs, 16);
+            for (int i = 0; i < n; i++) {
+                DSTRUCT_ASSERT(objs[i] == expected);
+                expected++;
+            }
+        } else if (queue.pop(val)) {
+            DSTRUCT_ASSERT(val == expected);
+            expected++;
+        }
+    }
+
+    producer.join();
+    DSTRUCT_ASSERT(queue.empty());
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_single_thread();
+    test_producer_consumer();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
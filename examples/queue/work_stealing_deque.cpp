@@ -0,0 +1,103 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+
+#include <dstruct.hpp>
+
+static void test_single_thread() {
+    dstruct::WorkStealingDeque<int> deque(3); // round up to 4
+
+    DSTRUCT_ASSERT(deque.capacity() == 4 && deque.empty());
+    for (int i = 0; i < 100; i++) deque.push(i); // grow 4 -> 128
+    DSTRUCT_ASSERT(deque.size() == 100 && deque.capacity() == 128);
+
+    int val;
+    DSTRUCT_ASSERT(deque.pop(val) && val == 99);   // owner: LIFO
+    DSTRUCT_ASSERT(deque.steal(val) && val == 0);  // thief: FIFO
+    for (int i = 98; i >= 1; i--) {
+        DSTRUCT_ASSERT(deque.pop(val) && val == i);
+    }
+    DSTRUCT_ASSERT(deque.empty() && !deque.pop(val) && !deque.steal(val));
+
+    // reuse after empty
+    deque.push(1);
+    DSTRUCT_ASSERT(deque.steal(val) && val == 1 && !deque.pop(val));
+
+    // instance alloc
+    dstruct::MonotonicArena<4096> arena;
+    dstruct::WorkStealingDeque<int *, decltype(arena)> arenaDeque(16, arena);
+    arenaDeque.push(&val);
+    DSTRUCT_ASSERT(arena.used_mem_size() > 0 && arenaDeque.size() == 1);
+}
+
+// owner push/pop and thieves steal concurrently, every value is taken exactly once
+static void test_multi_thread() {
+    const int thiefNum = 4, objNum = 200000;
+    dstruct::WorkStealingDeque<int> deque(2); // grow while thieves stealing
+    static std::atomic<int> takeCnt[objNum];
+    std::atomic<long long> sum { 0 };
+    std::atomic<int> takeNum { 0 };
+
+    dstruct::Vector<std::thread *> thieves;
+    for (int t = 0; t < thiefNum; t++) {
+        thieves.push_back(new std::thread([&] {
+            int val;
+            while (takeNum.load() < objNum) {
+                if (deque.steal(val)) {
+                    takeCnt[val]++;
+                    sum += val;
+                    takeNum++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+
+    int val;
+    for (int i = 0; i < objNum; i++) {
+        deque.push(i);
+        if (i % 3 == 0 && deque.pop(val)) {
+            takeCnt[val]++;
+            sum += val;
+            takeNum++;
+        }
+    }
+    while (deque.pop(val)) {
+        takeCnt[val]++;
+        sum += val;
+        takeNum++;
+    }
+
+    for (auto t : thieves) {
+        t->join();
+        delete t;
+    }
+
+    long long n = objNum;
+    DSTRUCT_ASSERT(deque.empty() && sum == n * (n - 1) / 2);
+    for (int i = 0; i < objNum; i++) {
+        DSTRUCT_ASSERT(takeCnt[i] == 1);
+    }
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_single_thread();
+    test_multi_thread();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+
+#include <dstruct.hpp>
+
+static void test_base_op() {
+    dstruct::RadixHeap<unsigned int> heap;
+
+    unsigned int data[] = { 5, 3, 8, 3, 0, 1000000, 7, 2 };
+    for (auto key : data) heap.push(key);
+    DSTRUCT_ASSERT(heap.size() == 8 && heap.top() == 0);
+
+    unsigned int sorted[] = { 0, 2, 3, 3, 5, 7, 8, 1000000 };
+    for (int i = 0; i < 4; i++) {
+        DSTRUCT_ASSERT(heap.top() == sorted[i]);
+        heap.pop();
+    }
+
+    heap.push(3); // == last popped key
+    heap.push(6);
+    unsigned int rest[] = { 3, 5, 6, 7, 8, 1000000 };
+    for (auto key : rest) {
+        DSTRUCT_ASSERT(heap.top() == key);
+        heap.pop();
+    }
+    DSTRUCT_ASSERT(heap.empty() && heap.last_key() == 1000000);
+
+    heap.clear();
+    heap.push(1);
+    DSTRUCT_ASSERT(heap.top() == 1);
+}
+
+// monotone workload: push keys >= the last popped, e.g. timer/Dijkstra
+static void test_monotone() {
+    dstruct::RadixHeap<unsigned long long> heap;
+    dstruct::PriorityQueue<unsigned long long> ref;
+    unsigned long long seed = 2023, last = 0;
+
+    for (int i = 0; i < 20000; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        unsigned long long key = last + (seed >> 40);
+        heap.push(key);
+        ref.push(key);
+        if (i % 3 == 0) {
+            DSTRUCT_ASSERT(heap.top() == ref.top());
+            last = heap.top();
+            heap.pop(); ref.pop();
+        }
+    }
+
+    while (!ref.empty()) {
+        DSTRUCT_ASSERT(heap.top() == ref.top());
+        heap.pop(); ref.pop();
+    }
+    DSTRUCT_ASSERT(heap.empty());
+}
+
+struct Event {
+    unsigned int time;
+    dstruct::String name;
+};
+
+struct EventTime {
+    using KeyType = unsigned int;
+    KeyType operator()(const Event &e) const { return e.time; }
+};
+
+static void test_key_of_obj() {
+    dstruct::RadixHeap<Event, EventTime> events;
+    events.push(Event { 30, "timer-c-without-sso" });
+    events.push(Event { 10, "timer-a-without-sso" });
+    events.push(Event { 20, "timer-b-without-sso" });
+
+    DSTRUCT_ASSERT(events.top().name == "timer-a-without-sso");
+    events.pop();
+    events.push(Event { 15, "timer-d-without-sso" });
+    DSTRUCT_ASSERT(events.top().time == 15);
+    events.pop();
+
+    auto copy = events;
+    auto moved = dstruct::move(events);
+    DSTRUCT_ASSERT(events.empty() && copy.size() == 2 && moved.top().name == "timer-b-without-sso");
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_base_op();
+    test_monotone();
+    test_key_of_obj();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
@@ -42,6 +42,26 @@ void printTreeStructure(Node::LinkType *root) {
     }
 }
 
+// stored height is the real height(and |balance factor| <= 1), return the height
+int checkHeight(Node::LinkType *root, bool balanced = true) {
+    if (root == nullptr) return 0;
+    int lHeight = checkHeight(root->left, balanced);
+    int rHeight = checkHeight(root->right, balanced);
+    if (balanced) DSTRUCT_ASSERT(lHeight - rHeight <= 1 && rHeight - lHeight <= 1);
+    int height = (lHeight > rHeight ? lHeight : rHeight) + 1;
+    DSTRUCT_ASSERT(Node::to_node(root)->data.height == height);
+    return height;
+}
+
+// white-box: rotate the root directly, the tree may be unbalanced after it
+class AVLTreeView : public dstruct::AVLTree<int, dstruct::less<int>, dstruct::Alloc> {
+public:
+    void rotate_root(bool toLeft) {
+        auto root = Node::to_link(_get_root_ptr());
+        root = toLeft ? _left_rotate(root) : _right_rotate(root);
+        _update_root(root);
+    }
+};
 
 int main() {
 
@@ -92,6 +112,37 @@ int main() {
 
     }
 
+    { // Test: L-Rotate updates the new root's height by both children
+        AVLTreeView avlTree;
+
+        for (int i = 0; i < 15; i++) { // perfect tree, height 4
+            avlTree.push(i);
+        }
+
+        // right side grows to height 4, then one L-Rotate: left 2, right 4
+        avlTree.rotate_root(false);
+        avlTree.rotate_root(false);
+        checkHeight(Node::to_link(avlTree._get_root_ptr()), false);
+        avlTree.rotate_root(true);
+        DSTRUCT_ASSERT(checkHeight(Node::to_link(avlTree._get_root_ptr()), false) == 5);
+        DSTRUCT_ASSERT(avlTree.height() == 5);
+    }
+
+    { // Test: pop a missing obj, the tree is untouched
+        dstruct::AVLTree<int, dstruct::less<int>, dstruct::Alloc> avlTree;
+
+        for (int i = 0; i < 100; i += 2) {
+            avlTree.push(i);
+        }
+
+        for (int i = -1; i <= 101; i += 2) {
+            avlTree.pop(i);
+        }
+
+        DSTRUCT_ASSERT(avlTree.size() == 50);
+        checkHeight(Node::to_link(avlTree._get_root_ptr()));
+    }
+
     // test AVLData_
     {
         struct A {
@@ -0,0 +1,131 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#include <iostream>
+
+#include <dstruct.hpp>
+#include <TestBase.hpp>
+
+using Link = dstruct::tree::RBTreeLink_;
+
+// return black height, -1 if a rule is broken
+static int check_rb_rules(const Link *root, const Link *parent) {
+    if (root == nullptr) return 1;
+    if (dstruct::tree::rb_parent(root) != parent) return -1;
+    if (dstruct::tree::rb_is_red(root) && (dstruct::tree::rb_is_red(root->left) || dstruct::tree::rb_is_red(root->right))) {
+        return -1;
+    }
+    int lH = check_rb_rules(root->left, root);
+    int rH = check_rb_rules(root->right, root);
+    if (lH < 0 || lH != rH) return -1;
+    return lH + (dstruct::tree::rb_is_red(root) ? 0 : 1);
+}
+
+template <typename Tree>
+static bool is_valid(const Tree &tree) {
+    auto root = tree._get_root_ptr();
+    if (dstruct::tree::rb_is_red(root)) return false;
+    if (check_rb_rules(root, nullptr) < 0) return false;
+
+    // sorted and size
+    unsigned long long num = 0;
+    auto last = tree.begin();
+    for (auto it = tree.begin(); it != tree.end(); it++, num++) {
+        if (num > 0 && !(*last < *it)) return false;
+        last = it;
+    }
+    return num == tree.size();
+}
+
+static void test_rb_tree() {
+    dstruct::RBTree<int> tree;
+    DSTRUCT_ASSERT(tree.empty() && tree.begin() == tree.end() && tree.height() == 0);
+
+    // sorted push: the worst case of an unbalanced tree
+    for (int i = 0; i < 1023; i++) tree.push(i);
+    tree.push(0); // exist
+    DSTRUCT_ASSERT(tree.size() == 1023 && is_valid(tree));
+    DSTRUCT_ASSERT(tree.height() <= 2 * 10);
+
+    for (int i = -10; i < 1033; i++) {
+        DSTRUCT_ASSERT(tree.contains(i) == (i >= 0 && i < 1023));
+    }
+
+    // erase while iterating: remove odd, iterator stays valid
+    for (auto it = tree.begin(); it != tree.end(); ) {
+        if (*it % 2) it = tree.erase(it);
+        else it++;
+    }
+    DSTRUCT_ASSERT(tree.size() == 512 && is_valid(tree));
+
+    tree.pop(0);
+    tree.pop(1); // not exist
+    DSTRUCT_ASSERT(tree.size() == 511 && *tree.begin() == 2 && is_valid(tree));
+
+    // copy / move
+    dstruct::RBTree<int> copyTree(tree);
+    dstruct::RBTree<int> moveTree(dstruct::move(tree));
+    DSTRUCT_ASSERT(tree.empty() && tree.find(2) == tree.end());
+    DSTRUCT_ASSERT(copyTree.size() == 511 && moveTree.size() == 511 && is_valid(copyTree));
+    DSTRUCT_ASSERT(*copyTree.find(1022) == 1022 && *moveTree.find(1022) == 1022);
+
+    for (int i = 0; i < 1023; i++) copyTree.pop(i);
+    DSTRUCT_ASSERT(copyTree.empty() && copyTree._get_root_ptr() == nullptr);
+
+    moveTree.clear();
+    DSTRUCT_ASSERT(moveTree.empty() && moveTree.begin() == moveTree.end());
+}
+
+// random push/pop(1 : 1), check with a brute-force table and the rb rules
+static void test_random_op() {
+    using PoolRBTree = dstruct::pmemory::RBTree<int>;
+    PoolRBTree tree;
+    test::test_random_set_op(tree, 2000, 100000, 1, is_valid<PoolRBTree>);
+}
+
+static void test_rb_tree_map() {
+    // price level -> quantity
+    dstruct::RBTreeMap<int, long long> book;
+
+    for (int i = 0; i < 100; i++) book[1000 + (i * 37) % 100] += i;
+    DSTRUCT_ASSERT(book.size() == 100 && book.begin()->key == 1000);
+
+    auto result = book.try_emplace(1050, 7);
+    DSTRUCT_ASSERT(!result.inserted);
+    result = book.insert_or_assign(2000, 7LL);
+    DSTRUCT_ASSERT(result.inserted && book[2000] == 7);
+
+    // erase the best levels
+    for (auto it = book.begin(); it != book.end() && it->key < 1050; ) {
+        it = book.erase(it);
+    }
+    DSTRUCT_ASSERT(book.size() == 51 && book.begin()->key == 1050);
+
+    book.pop(2000);
+    DSTRUCT_ASSERT(book.find(2000) == book.end() && book.size() == 50);
+
+    dstruct::pmemory::RBTreeMap<int, dstruct::String> poolMap;
+    poolMap[3] = "c";
+    poolMap[1] = "a";
+    poolMap.push({ 2, "b" });
+    DSTRUCT_ASSERT(poolMap.size() == 3 && poolMap[2] == "b" && poolMap.begin()->value == "a");
+}
+
+int main() {
+
+    std::cout << "\nTesting: " << __FILE__;
+
+    test_rb_tree();
+    test_random_op();
+    test_rb_tree_map();
+
+    std::cout << "   pass" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef ALIGNED_ALLOC_HPP_DSTRUCT
+#define ALIGNED_ALLOC_HPP_DSTRUCT
+
+#include <core/common.hpp>
+
+namespace dstruct {
+
+/*
+AlignedAlloc: static alloc adapter, every block is ALIGN-aligned (default: cache line)
+
+    from Upstream: bytes + ALIGN
+    +-----------------+--------+----------------------------------+
+    | unused          | offset | block(bytes)                     |
+    +-----------------+--------+----------------------------------+
+    ^                          ^
+    raw                        return addr(ALIGN-aligned), offset = addr - raw(1 ~ ALIGN)
+
+    SKEW: addr - SKEW is ALIGN-aligned instead, for a layout with a virtual header(e.g. Heap's padding)
+
+usage:
+    dstruct::Vector<T, dstruct::AlignedAlloc<dstruct::Alloc>> // element 0 start at a cache line
+    dstruct::Vector<T, dstruct::AlignedAlloc<dstruct::Alloc, 64, 3 * sizeof(T)>> // element 3(virtual) start at a cache line
+*/
+
+template <typename Upstream, int ALIGN = DSTRUCT_CACHE_LINE_SIZE, int SKEW = 0>
+struct AlignedAlloc {
+
+    static_assert(ALIGN >= 2 && ALIGN <= 128 && (ALIGN & (ALIGN - 1)) == 0, "ALIGN isn't power of 2 in [2, 128]");
+    static_assert(SKEW >= 0, "SKEW < 0");
+
+    static void * allocate(int bytes) {
+        unsigned char *raw = static_cast<unsigned char *>(Upstream::allocate(bytes + ALIGN));
+        if (raw == nullptr) return nullptr;
+
+        // at least 1 byte before addr to save the offset
+        unsigned char *addr = reinterpret_cast<unsigned char *>(
+            (reinterpret_cast<port::size_t>(raw) + ALIGN - SKEW % ALIGN) & ~static_cast<port::size_t>(ALIGN - 1)
+        ) + SKEW % ALIGN;
+        addr[-1] = static_cast<unsigned char>(addr - raw);
+
+        return addr;
+    }
+
+    static void deallocate(void *addr, int bytes) {
+        if (addr == nullptr) return;
+        unsigned char *ptr = static_cast<unsigned char *>(addr);
+        Upstream::deallocate(ptr - ptr[-1], bytes + ALIGN);
+    }
+};
+
+}
+
+#endif
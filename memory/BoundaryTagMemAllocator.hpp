@@ -0,0 +1,311 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef BOUNDARY_TAG_MEM_ALLOCATOR_HPP_DSTRUCT
+#define BOUNDARY_TAG_MEM_ALLOCATOR_HPP_DSTRUCT
+
+// only use no-dependency and static data-structures
+#include <core/utils.hpp>
+#include <core/ds/array/Array.hpp>
+#include <core/ds/linked-list/EmbeddedList.hpp>
+#include <memory/StaticMemAllocator.hpp>
+
+namespace dstruct {
+
+/*
+mem-block: boundary tag (header/footer)
+
+    used block                      free block
+    +-------------------+           +-------------------+
+    | header(size|flag) |           | header(size|flag) |
+    +-------------------+           +-------------------+
+    |                   |           | link(next/prev)   | --> mFreeMemList_d[index]
+    |   data            |           |   ...             |
+    |                   |           +-------------------+
+    |                   |           | footer(size)      | <-- used by next block to find it
+    +-------------------+           +-------------------+
+
+mFreeMemList_d: segregated size-class, when SMA_MEM_ALIGN equal 8
+    +----------------------------------------------------+
+    | 0 | 1 | ... | n-1 | n      | n+1     | ... | m-1 | - index
+    +----------------------------------------------------+
+    | 8 | 16| ... | 8*n | [2^k, 2^(k+1)) | ...     | ... | - block size, k = log2(MAX_BLOCK_SIZE)
+    +----------------------------------------------------+
+    mBitmap_d: bit i == 1 <==> mFreeMemList_d[i] isn't empty
+
+    allocate:   find first non-empty list by bitmap (ctz) - O(1)
+    deallocate: coalesce with prev/next block by boundary tag - O(1)
+*/
+
+// Note: request MEMORY_SIZE % SMA_MEM_ALIGN == 0
+template <int MEMORY_SIZE, int MAX_BLOCK_SIZE = 128>
+struct BoundaryTagMemAllocator {
+
+private:
+    using Link_e = DoublyLink_;
+
+    struct BlockTag_ {
+        int size;   // block size, include header
+        int status; // only for header
+    };
+
+    enum BlockStatus_ : int {
+        FREE = 0,
+        USED = 1,
+        PREV_USED = 2,
+    };
+
+    constexpr static int LOG2_(int n) {
+        return n <= 1 ? 0 : 1 + LOG2_(n / 2);
+    }
+
+    constexpr static int TAG_SIZE = sizeof(BlockTag_);
+    constexpr static int MIN_BLOCK_SIZE =
+        (2 * sizeof(BlockTag_) + sizeof(Link_e) + SMA_MEM_ALIGN - 1) & ~(SMA_MEM_ALIGN - 1);
+    constexpr static int QUICK_LIST_NUM = MAX_BLOCK_SIZE / SMA_MEM_ALIGN;
+    constexpr static int FREE_LIST_NUM = QUICK_LIST_NUM + LOG2_(MEMORY_SIZE) - LOG2_(MAX_BLOCK_SIZE) + 1;
+
+    static_assert(MEMORY_SIZE % SMA_MEM_ALIGN == 0, "MEMORY_SIZE % SMA_MEM_ALIGN != 0");
+    static_assert(MEMORY_SIZE >= MIN_BLOCK_SIZE, "MEMORY_SIZE too small");
+    static_assert(TAG_SIZE == SMA_MEM_ALIGN, "block tag should keep data aligned");
+    static_assert(FREE_LIST_NUM <= 64, "free list index out of bitmap range");
+
+private: // big five
+    BoundaryTagMemAllocator() : mFreeMemSize_d { 0 }, mBitmap_d { 0 } {
+        for (int i = 0; i < FREE_LIST_NUM; i++) {
+            Link_e::init(&(mFreeMemList_d[i]));
+        }
+        auto tagPtr = reinterpret_cast<BlockTag_ *>(mMemoryPool_d);
+        tagPtr->status = PREV_USED; // no prev block
+        insert_mem_block_to_list_d(tagPtr, MEMORY_SIZE);
+        mFreeMemSize_d = MEMORY_SIZE;
+    }
+
+    BoundaryTagMemAllocator(const BoundaryTagMemAllocator&) = delete;
+    BoundaryTagMemAllocator & operator=(const BoundaryTagMemAllocator&) = delete;
+
+public: // mem-alloc interface
+    static void * allocate(int bytes) {
+        return Instance_().allocate_d(bytes);
+    }
+
+    static bool deallocate(void *addr, int bytes) {
+        return Instance_().deallocate_d(addr, bytes);
+    }
+
+public: // mem-manager interface
+
+    constexpr static int MEM_ALIGN_ROUND_UP(int bytes) {
+        return (((bytes) + SMA_MEM_ALIGN - 1) & ~(SMA_MEM_ALIGN - 1));
+    }
+
+    // free block size, include block header
+    static int free_mem_size() {
+        return Instance_().mFreeMemSize_d;
+    }
+
+    // max bytes that can be allocated at once
+    static int max_free_mblock_size() {
+        auto &sma = Instance_();
+        if (sma.mBitmap_d == 0) return 0;
+        int listIndex = dstruct::floor_log2(sma.mBitmap_d);
+        int maxSize = 0;
+        Link_e *head = &(sma.mFreeMemList_d[listIndex]);
+        for (Link_e *linkPtr = head->next; linkPtr != head; linkPtr = linkPtr->next) {
+            if (maxSize < to_block_(linkPtr)->size) maxSize = to_block_(linkPtr)->size;
+        }
+        return maxSize - TAG_SIZE;
+    }
+
+    // blocks are coalesced when deallocate, keep the interface of StaticMemAllocator
+    static void memory_merge() { }
+
+    static void dump() {
+        auto &sma = Instance_();
+        SMA_LOGD("sma(boundary-tag) dump(total %d, used %d, free %d):",
+            MEMORY_SIZE, MEMORY_SIZE - sma.mFreeMemSize_d, sma.mFreeMemSize_d);
+        int verifyFreeMemSize = 0;
+        bool prevUsed = true;
+        auto tagPtr = reinterpret_cast<BlockTag_ *>(sma.mMemoryPool_d);
+        while (tagPtr != nullptr) {
+            bool used = tagPtr->status & USED;
+            SMA_LOGD("\taddr %p, size %d, %s", tagPtr, tagPtr->size, used ? "used" : "free");
+            // check: boundary tag and coalesce
+            DSTRUCT_CRASH(prevUsed != static_cast<bool>(tagPtr->status & PREV_USED));
+            if (!used) {
+                DSTRUCT_CRASH(!prevUsed);
+                DSTRUCT_CRASH(footer_(tagPtr)->size != tagPtr->size);
+                verifyFreeMemSize += tagPtr->size;
+            }
+            prevUsed = used;
+            tagPtr = sma.next_block_d(tagPtr);
+        }
+
+        SMA_LOGD("\tfree-mem verify: %d == %d", sma.mFreeMemSize_d, verifyFreeMemSize);
+
+        DSTRUCT_CRASH(sma.mFreeMemSize_d != verifyFreeMemSize);
+    }
+
+protected:
+    int mFreeMemSize_d;
+    unsigned long long mBitmap_d;
+    dstruct::Array<Link_e, FREE_LIST_NUM> mFreeMemList_d;
+    alignas(SMA_MEM_ALIGN) char mMemoryPool_d[MEMORY_SIZE];
+
+    static BoundaryTagMemAllocator & Instance_() {
+        static BoundaryTagMemAllocator sma; // create & manage static memory area
+        return sma;
+    }
+
+    // request: bytes % SMA_MEM_ALIGN == 0
+    static int SIZE_TO_INDEX_(int bytes) {
+        return bytes <= MAX_BLOCK_SIZE ?
+            bytes / SMA_MEM_ALIGN - 1 :
+            QUICK_LIST_NUM + dstruct::floor_log2(bytes) - LOG2_(MAX_BLOCK_SIZE);
+    }
+
+    static Link_e * to_link_(BlockTag_ *tagPtr) {
+        return reinterpret_cast<Link_e *>(tagPtr + 1);
+    }
+
+    static BlockTag_ * to_block_(Link_e *linkPtr) {
+        return reinterpret_cast<BlockTag_ *>(linkPtr) - 1;
+    }
+
+    static BlockTag_ * footer_(BlockTag_ *tagPtr) {
+        return reinterpret_cast<BlockTag_ *>(reinterpret_cast<char *>(tagPtr) + tagPtr->size) - 1;
+    }
+
+    BlockTag_ * next_block_d(BlockTag_ *tagPtr) {
+        char *next = reinterpret_cast<char *>(tagPtr) + tagPtr->size;
+        if (next >= mMemoryPool_d + MEMORY_SIZE) return nullptr;
+        return reinterpret_cast<BlockTag_ *>(next);
+    }
+
+    void * allocate_d(int bytes) {
+
+        if (bytes <= 0) return nullptr;
+
+        int allocatedSize = MEM_ALIGN_ROUND_UP(bytes + TAG_SIZE);
+        if (allocatedSize < MIN_BLOCK_SIZE) allocatedSize = MIN_BLOCK_SIZE;
+
+        BlockTag_ *tagPtr = find_mem_block_d(allocatedSize);
+
+        if (tagPtr == nullptr) return nullptr;
+
+        delete_mem_block_from_list_d(tagPtr);
+
+        int memFragmentSize = tagPtr->size - allocatedSize;
+        if (memFragmentSize >= MIN_BLOCK_SIZE) {
+            // split and insert memory fragment to list
+            tagPtr->size = allocatedSize;
+            auto fragmentPtr = next_block_d(tagPtr);
+            fragmentPtr->status = PREV_USED;
+            insert_mem_block_to_list_d(fragmentPtr, memFragmentSize);
+        } else {
+            auto nextPtr = next_block_d(tagPtr);
+            if (nextPtr) nextPtr->status |= PREV_USED;
+        }
+
+        tagPtr->status |= USED;
+        mFreeMemSize_d -= tagPtr->size;
+
+        return to_link_(tagPtr);
+    }
+
+    bool deallocate_d(void *addr, int bytes) {
+        if (bytes <= 0 || addr == nullptr) return false;
+
+        BlockTag_ *tagPtr = to_block_(static_cast<Link_e *>(addr));
+
+        // check: double free or size mismatch
+        if (!(tagPtr->status & USED) || tagPtr->size < MEM_ALIGN_ROUND_UP(bytes + TAG_SIZE))
+            return false;
+
+        int size = tagPtr->size;
+        mFreeMemSize_d += size;
+
+        // coalesce - next block
+        auto nextPtr = next_block_d(tagPtr);
+        if (nextPtr != nullptr && !(nextPtr->status & USED)) {
+            delete_mem_block_from_list_d(nextPtr);
+            size += nextPtr->size;
+        }
+
+        // coalesce - prev block (by prev-block's footer)
+        if (!(tagPtr->status & PREV_USED)) {
+            auto prevPtr = reinterpret_cast<BlockTag_ *>(
+                reinterpret_cast<char *>(tagPtr) - (tagPtr - 1)->size
+            );
+            delete_mem_block_from_list_d(prevPtr);
+            size += prevPtr->size;
+            tagPtr = prevPtr;
+        }
+
+        insert_mem_block_to_list_d(tagPtr, size);
+
+        return true;
+    }
+
+protected: // free list manager
+    BlockTag_ * find_mem_block_d(int bytes) {
+        int listIndex = SIZE_TO_INDEX_(bytes);
+
+        // big block list only keep the low bound(2^k), so start from next list
+        // if bytes isn't 2^k, then every block in the list is big enough
+        int startIndex = listIndex;
+        if (bytes > MAX_BLOCK_SIZE && (bytes & (bytes - 1)) != 0) startIndex++;
+
+        if (startIndex < FREE_LIST_NUM) {
+            auto bitmap = mBitmap_d & (~0ULL << startIndex);
+            if (bitmap != 0) {
+                return to_block_(mFreeMemList_d[dstruct::count_trailing_zeros(bitmap)].next);
+            }
+        }
+
+        // fallback: first fit in the list of bytes (only near exhausted)
+        if (startIndex != listIndex) {
+            Link_e *head = &(mFreeMemList_d[listIndex]);
+            for (Link_e *linkPtr = head->next; linkPtr != head; linkPtr = linkPtr->next) {
+                if (to_block_(linkPtr)->size >= bytes) return to_block_(linkPtr);
+            }
+        }
+
+        return nullptr;
+    }
+
+    // mark block free, write footer and add it to free list
+    void insert_mem_block_to_list_d(BlockTag_ *tagPtr, int size) {
+        tagPtr->size = size;
+        tagPtr->status &= PREV_USED;
+        footer_(tagPtr)->size = size;
+        footer_(tagPtr)->status = FREE;
+
+        int listIndex = SIZE_TO_INDEX_(size);
+        Link_e::add(&(mFreeMemList_d[listIndex]), to_link_(tagPtr));
+        mBitmap_d |= 1ULL << listIndex;
+
+        auto nextPtr = next_block_d(tagPtr);
+        if (nextPtr) nextPtr->status &= ~PREV_USED;
+    }
+
+    void delete_mem_block_from_list_d(BlockTag_ *tagPtr) {
+        int listIndex = SIZE_TO_INDEX_(tagPtr->size);
+        Link_e *linkPtr = to_link_(tagPtr);
+        Link_e::del(linkPtr->prev, linkPtr);
+        if (Link_e::empty(&(mFreeMemList_d[listIndex]))) {
+            mBitmap_d &= ~(1ULL << listIndex);
+        }
+    }
+
+};
+
+}
+
+#endif
@@ -0,0 +1,222 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef CONCURRENT_MEM_ALLOCATOR_HPP_DSTRUCT
+#define CONCURRENT_MEM_ALLOCATOR_HPP_DSTRUCT
+
+#include <atomic>
+#include <thread>
+
+#include <core/ds/array/Array.hpp>
+#include <core/ds/linked-list/EmbeddedList.hpp>
+#include <memory/StaticMemAllocator.hpp>
+
+namespace dstruct {
+
+/*
+ConcurrentMemAllocator: thread-safe wrapper for SMA(StaticMemAllocator / BoundaryTagMemAllocator)
+
+    thread1        thread2        threadN
+    +-------+      +-------+      +-------+
+    | cache |      | cache |      | cache |   - thread local, size-class lists, no lock
+    +-------+      +-------+      +-------+
+        |  ^           |  ^           |  ^
+ refill |  | flush     |  |           |  |    - batch(BATCH_NUM blocks) with lock
+        V  |           V  |           V  |
+    +----------------------------------------+
+    |         SMA (shared, spin lock)        |  - big block(> MAX_CACHE_BLOCK_SIZE) direct
+    +----------------------------------------+
+*/
+
+template <typename SMA, int MAX_CACHE_BLOCK_SIZE = 128, int BATCH_NUM = 16>
+struct ConcurrentMemAllocator {
+
+private:
+    using Link_e = SinglyLink_;
+
+    constexpr static int CACHE_LIST_NUM = MAX_CACHE_BLOCK_SIZE / SMA_MEM_ALIGN;
+
+    static_assert(BATCH_NUM > 0, "BATCH_NUM <= 0");
+
+    struct SpinLock_ {
+        std::atomic_flag flag = ATOMIC_FLAG_INIT;
+
+        void lock() {
+            int spinCnt = 0;
+            while (flag.test_and_set(std::memory_order_acquire)) {
+                // lock holder may be preempted, give up cpu
+                if (++spinCnt % 64 == 0) std::this_thread::yield();
+            }
+        }
+
+        void unlock() {
+            flag.clear(std::memory_order_release);
+        }
+    };
+
+    struct LockGuard_ {
+        LockGuard_() { Lock_().lock(); }
+        ~LockGuard_() { Lock_().unlock(); }
+    };
+
+    struct ThreadCache_ {
+        dstruct::Array<Link_e, CACHE_LIST_NUM> freeList; // end with nullptr
+        dstruct::Array<int, CACHE_LIST_NUM> freeNum;
+
+        ThreadCache_() : freeList(Link_e{ nullptr }), freeNum(0) { }
+
+        // thread exit: give back all cached mem-block
+        ~ThreadCache_() {
+            for (int i = 0; i < CACHE_LIST_NUM; i++) {
+                flush_(*this, i, freeNum[i]);
+            }
+        }
+    };
+
+public: // mem-alloc interface
+    static void * allocate(int bytes) {
+        if (bytes <= 0) return nullptr;
+
+        if (bytes > MAX_CACHE_BLOCK_SIZE) {
+            LockGuard_ guard;
+            return sma_allocate_(bytes);
+        }
+
+        auto &cache = Cache_();
+        int index = SIZE_TO_INDEX_(bytes);
+
+        if (cache.freeList[index].next == nullptr) {
+            refill_(cache, index);
+        }
+
+        Link_e *linkPtr = cache.freeList[index].next;
+        if (linkPtr != nullptr) {
+            cache.freeList[index].next = linkPtr->next;
+            cache.freeNum[index]--;
+        }
+
+        return linkPtr;
+    }
+
+    static bool deallocate(void *addr, int bytes) {
+        if (bytes <= 0 || addr == nullptr) return false;
+
+        if (bytes > MAX_CACHE_BLOCK_SIZE) {
+            LockGuard_ guard;
+            return SMA::deallocate(addr, bytes);
+        }
+
+        auto &cache = Cache_();
+        int index = SIZE_TO_INDEX_(bytes);
+
+        Link_e::add(&(cache.freeList[index]), static_cast<Link_e *>(addr));
+        cache.freeNum[index]++;
+
+        // keep BATCH_NUM blocks for the next allocate, give back the rest
+        if (cache.freeNum[index] >= 2 * BATCH_NUM) {
+            flush_(cache, index, BATCH_NUM);
+        }
+
+        return true;
+    }
+
+public: // mem-manager interface
+    // Note: not include the mem-block in thread cache
+    static int free_mem_size() {
+        LockGuard_ guard;
+        return SMA::free_mem_size();
+    }
+
+    static int max_free_mblock_size() {
+        LockGuard_ guard;
+        return SMA::max_free_mblock_size();
+    }
+
+    static void memory_merge() {
+        LockGuard_ guard;
+        SMA::memory_merge();
+    }
+
+    // give back all mem-block cached by current thread
+    static void flush() {
+        auto &cache = Cache_();
+        for (int i = 0; i < CACHE_LIST_NUM; i++) {
+            flush_(cache, i, cache.freeNum[i]);
+        }
+    }
+
+    static void dump() {
+        LockGuard_ guard;
+        SMA::dump();
+    }
+
+protected:
+    static SpinLock_ & Lock_() {
+        static SpinLock_ lock;
+        return lock;
+    }
+
+    static ThreadCache_ & Cache_() {
+        static thread_local ThreadCache_ cache;
+        return cache;
+    }
+
+    constexpr static int SIZE_TO_INDEX_(int bytes) {
+        return SMA::MEM_ALIGN_ROUND_UP(bytes) / SMA_MEM_ALIGN - 1;
+    }
+
+    constexpr static int INDEX_TO_SIZE_(int index) {
+        return (index + 1) * SMA_MEM_ALIGN;
+    }
+
+    // request: locked
+    static void * sma_allocate_(int bytes) {
+        void *memPtr = SMA::allocate(bytes);
+        if (memPtr == nullptr) {
+            SMA::memory_merge();
+            memPtr = SMA::allocate(bytes);
+        }
+        return memPtr;
+    }
+
+    static void refill_(ThreadCache_ &cache, int index) {
+        LockGuard_ guard;
+        for (int i = 0; i < BATCH_NUM; i++) {
+            void *memPtr = sma_allocate_(INDEX_TO_SIZE_(index));
+            if (memPtr == nullptr) break;
+            Link_e::add(&(cache.freeList[index]), static_cast<Link_e *>(memPtr));
+            cache.freeNum[index]++;
+        }
+    }
+
+    static void flush_(ThreadCache_ &cache, int index, int num) {
+        if (num <= 0) return;
+
+        // take out from cache without lock
+        Link_e *first = cache.freeList[index].next;
+        Link_e *last = first;
+        for (int i = 1; i < num; i++) {
+            last = last->next;
+        }
+        cache.freeList[index].next = last->next;
+        cache.freeNum[index] -= num;
+        last->next = nullptr;
+
+        LockGuard_ guard;
+        while (first != nullptr) {
+            Link_e *next = first->next;
+            SMA::deallocate(first, INDEX_TO_SIZE_(index));
+            first = next;
+        }
+    }
+};
+
+}
+
+#endif
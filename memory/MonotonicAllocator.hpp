@@ -0,0 +1,146 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef MONOTONIC_ALLOCATOR_HPP_DSTRUCT
+#define MONOTONIC_ALLOCATOR_HPP_DSTRUCT
+
+#include <core/utils.hpp>
+
+namespace dstruct {
+
+/*
+MonotonicAllocator: instance alloc, bump pointer in chunks from Upstream(static Alloc)
+
+    mChunkList_d
+        |
+        V
+    +--------+-------------------------+     +--------+---------------+
+    | Chunk_ | used | used |  remain   | --> | Chunk_ | used | used   | --> nullptr
+    +--------+-------------------------+     +--------+---------------+
+                           ^           ^
+                           mCurr_d     mEnd_d
+
+    allocate:   bump mCurr_d, get a new chunk(size doubling) when current is exhausted
+    deallocate: no-op
+    release:    give back all chunks to Upstream
+
+usage:
+    dstruct::MonotonicAllocator<dstruct::Alloc> mAlloc;
+    dstruct::AVLTree<int, dstruct::less<int>, decltype(mAlloc)> avl(mAlloc);
+*/
+
+template <typename Upstream, int CHUNK_SIZE = 4096, int MEM_ALIGN = 8>
+class MonotonicAllocator {
+
+    static_assert((MEM_ALIGN & (MEM_ALIGN - 1)) == 0, "MEM_ALIGN isn't power of 2");
+
+    struct Chunk_ {
+        Chunk_ *next;
+        int size; // include Chunk_
+    };
+
+    constexpr static int CHUNK_HEADER_SIZE = (sizeof(Chunk_) + MEM_ALIGN - 1) & ~(MEM_ALIGN - 1);
+    constexpr static int MAX_CHUNK_SIZE = 1 << 30;
+
+    static_assert(CHUNK_SIZE > CHUNK_HEADER_SIZE, "CHUNK_SIZE too small");
+
+public:
+    using InstanceAllocTag = void;
+
+public: // big five
+    MonotonicAllocator() :
+        mChunkList_d { nullptr }, mCurr_d { nullptr }, mEnd_d { nullptr },
+        mNextChunkSize_d { CHUNK_SIZE }, mChunkMemSize_d { 0 } { }
+
+    // bound by address, don't copy/move it
+    MonotonicAllocator(const MonotonicAllocator &) = delete;
+    MonotonicAllocator & operator=(const MonotonicAllocator &) = delete;
+
+    ~MonotonicAllocator() {
+        release();
+    }
+
+public: // mem-alloc interface
+    void * allocate(int bytes) {
+        if (bytes <= 0) return nullptr;
+
+        bytes = MEM_ALIGN_ROUND_UP_(bytes);
+        if (bytes > mEnd_d - mCurr_d && !_new_chunk(bytes)) {
+            return nullptr;
+        }
+
+        void *memPtr = mCurr_d;
+        mCurr_d += bytes;
+        return memPtr;
+    }
+
+    void deallocate(void *, int) {
+        // no-op, memory is given back by release()
+    }
+
+public: // mem-manager interface
+    void release() {
+        while (mChunkList_d != nullptr) {
+            Chunk_ *next = mChunkList_d->next;
+            Upstream::deallocate(mChunkList_d, mChunkList_d->size);
+            mChunkList_d = next;
+        }
+        mCurr_d = mEnd_d = nullptr;
+        mNextChunkSize_d = CHUNK_SIZE;
+        mChunkMemSize_d = 0;
+    }
+
+    // total memory got from Upstream
+    int chunk_mem_size() const {
+        return mChunkMemSize_d;
+    }
+
+    int free_mem_size() const {
+        return mEnd_d - mCurr_d;
+    }
+
+protected:
+    Chunk_ *mChunkList_d;
+    char *mCurr_d, *mEnd_d;
+    int mNextChunkSize_d;
+    int mChunkMemSize_d;
+
+    constexpr static int MEM_ALIGN_ROUND_UP_(int bytes) {
+        return (bytes + MEM_ALIGN - 1) & ~(MEM_ALIGN - 1);
+    }
+
+    bool _new_chunk(int bytes) {
+        int chunkSize = mNextChunkSize_d;
+        if (bytes > chunkSize - CHUNK_HEADER_SIZE) {
+            chunkSize = bytes + CHUNK_HEADER_SIZE; // big block: use exclusive chunk
+        }
+
+        Chunk_ *chunkPtr = static_cast<Chunk_ *>(Upstream::allocate(chunkSize));
+        if (chunkPtr == nullptr) return false;
+
+        chunkPtr->next = mChunkList_d;
+        chunkPtr->size = chunkSize;
+        mChunkList_d = chunkPtr;
+        mChunkMemSize_d += chunkSize;
+
+        mCurr_d = reinterpret_cast<char *>(chunkPtr) + CHUNK_HEADER_SIZE;
+        mEnd_d = reinterpret_cast<char *>(chunkPtr) + chunkSize;
+
+        // geometric growth: fewer upstream calls for big dstruct
+        if (mNextChunkSize_d < MAX_CHUNK_SIZE / 2) {
+            mNextChunkSize_d *= 2;
+        }
+
+        return true;
+    }
+};
+
+}
+
+#endif
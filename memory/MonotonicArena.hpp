@@ -0,0 +1,94 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef MONOTONIC_ARENA_HPP_DSTRUCT
+#define MONOTONIC_ARENA_HPP_DSTRUCT
+
+namespace dstruct {
+
+/*
+MonotonicArena: instance alloc(non-singleton), bump pointer in a fixed buffer
+
+    +----------------------------------------------+
+    | used | used | used |         remain          |
+    +----------------------------------------------+
+    ^                    ^                          ^
+    mMemoryPool_d        mTop_d                     MEMORY_SIZE
+
+    allocate:   move mTop_d forward - O(1)
+    deallocate: only roll back the last mem-block, others are no-op
+    release:    reset mTop_d, drop everything at once - O(1)
+
+usage: pass the arena to dstruct at construction
+    dstruct::MonotonicArena<64 * 1024> arena;
+    dstruct::Vector<int, decltype(arena)> vec(arena);
+    ...
+    arena.release(); // request: all dstruct using the arena are destroyed
+*/
+
+template <int MEMORY_SIZE, int MEM_ALIGN = 8>
+class MonotonicArena {
+
+    static_assert((MEM_ALIGN & (MEM_ALIGN - 1)) == 0, "MEM_ALIGN isn't power of 2");
+    static_assert(MEMORY_SIZE % MEM_ALIGN == 0, "MEMORY_SIZE % MEM_ALIGN != 0");
+
+public:
+    using InstanceAllocTag = void;
+
+public: // big five
+    MonotonicArena() : mTop_d { 0 } { }
+
+    // arena is bound by address, don't copy/move it
+    MonotonicArena(const MonotonicArena &) = delete;
+    MonotonicArena & operator=(const MonotonicArena &) = delete;
+
+    ~MonotonicArena() = default;
+
+public: // mem-alloc interface
+    void * allocate(int bytes) {
+        bytes = MEM_ALIGN_ROUND_UP_(bytes);
+        if (bytes <= 0 || bytes > MEMORY_SIZE - mTop_d)
+            return nullptr;
+        void *memPtr = mMemoryPool_d + mTop_d;
+        mTop_d += bytes;
+        return memPtr;
+    }
+
+    void deallocate(void *addr, int bytes) {
+        bytes = MEM_ALIGN_ROUND_UP_(bytes);
+        if (static_cast<char *>(addr) + bytes == mMemoryPool_d + mTop_d) {
+            mTop_d -= bytes;
+        }
+    }
+
+public: // mem-manager interface
+    void release() {
+        mTop_d = 0;
+    }
+
+    int used_mem_size() const {
+        return mTop_d;
+    }
+
+    int free_mem_size() const {
+        return MEMORY_SIZE - mTop_d;
+    }
+
+protected:
+    int mTop_d;
+    alignas(MEM_ALIGN) char mMemoryPool_d[MEMORY_SIZE];
+
+    constexpr static int MEM_ALIGN_ROUND_UP_(int bytes) {
+        return (bytes + MEM_ALIGN - 1) & ~(MEM_ALIGN - 1);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,136 @@
+// Use of this source code is governed by Apache-2.0 License
+// that can be found in the License file.
+//
+// Copyright (C) 2023 - present  Sunrisepeak
+//
+// Author: Sunrisepeak (speakshen@163.com)
+// ProjectLinks: https://github.com/Sunrisepeak/DStruct
+//
+
+#ifndef POOL_ALLOC_HPP_DSTRUCT
+#define POOL_ALLOC_HPP_DSTRUCT
+
+#include <core/ds/linked-list/EmbeddedList.hpp>
+
+namespace dstruct {
+
+/*
+PoolAlloc: fixed-size object pool(static alloc), for node-based dstruct
+
+    slab(from Upstream)
+    +------+---------+---------+-----+---------+-------------------+
+    | link | block   | block   | ... | block   |  remain(uncarved) |
+    +------+---------+---------+-----+---------+-------------------+
+       |       ^                                ^                   ^
+       V       | mFreeList_d(intrusive)         mCurr_d             mEnd_d
+     next slab
+
+    allocate:   pop free list, or carve a block from current slab - O(1)
+    deallocate: push to free list - O(1), no per-block header
+    bytes > BLOCK_SIZE: forward to Upstream (e.g. Deque's map-table)
+
+Note: slabs are kept for reuse until process exit, and it isn't thread-safe
+usage:
+    dstruct::DLinkedList<int, dstruct::PoolAlloc<sizeof(NodeType), dstruct::Alloc>>
+    or the dstruct::pmemory aliases
+*/
+
+template <int BLOCK_SIZE, typename Upstream, int SLAB_SIZE = 4096>
+struct PoolAlloc {
+
+private:
+    using Link_e = SinglyLink_;
+
+    constexpr static int MEM_ALIGN = 8;
+    constexpr static int SLAB_HEADER_SIZE = (sizeof(Link_e) + MEM_ALIGN - 1) & ~(MEM_ALIGN - 1);
+
+public:
+    // block need to hold a link when it is free
+    constexpr static int POOL_BLOCK_SIZE =
+        ((BLOCK_SIZE > static_cast<int>(sizeof(Link_e)) ? BLOCK_SIZE : sizeof(Link_e)) + MEM_ALIGN - 1) & ~(MEM_ALIGN - 1);
+
+    static_assert(BLOCK_SIZE > 0, "BLOCK_SIZE <= 0");
+    static_assert(SLAB_SIZE - SLAB_HEADER_SIZE >= POOL_BLOCK_SIZE, "SLAB_SIZE too small");
+
+private: // big five
+    PoolAlloc() : mFreeList_d { nullptr }, mSlabList_d { nullptr },
+        mCurr_d { nullptr }, mEnd_d { nullptr }, mSlabNum_d { 0 }, mFreeBlockNum_d { 0 } { }
+
+    PoolAlloc(const PoolAlloc &) = delete;
+    PoolAlloc & operator=(const PoolAlloc &) = delete;
+
+public: // mem-alloc interface
+    static void * allocate(int bytes) {
+        if (bytes <= 0) return nullptr;
+        if (bytes > POOL_BLOCK_SIZE) return Upstream::allocate(bytes);
+
+        auto &pool = Instance_();
+
+        Link_e *linkPtr = pool.mFreeList_d.next;
+        if (linkPtr != nullptr) {
+            pool.mFreeList_d.next = linkPtr->next;
+            pool.mFreeBlockNum_d--;
+            return linkPtr;
+        }
+
+        if (pool.mEnd_d - pool.mCurr_d < POOL_BLOCK_SIZE && !pool.new_slab_d()) {
+            return nullptr;
+        }
+
+        void *memPtr = pool.mCurr_d;
+        pool.mCurr_d += POOL_BLOCK_SIZE;
+        return memPtr;
+    }
+
+    static void deallocate(void *addr, int bytes) {
+        if (addr == nullptr || bytes <= 0) return;
+        if (bytes > POOL_BLOCK_SIZE) {
+            Upstream::deallocate(addr, bytes);
+            return;
+        }
+
+        auto &pool = Instance_();
+        Link_e::add(&(pool.mFreeList_d), static_cast<Link_e *>(addr));
+        pool.mFreeBlockNum_d++;
+    }
+
+public: // mem-manager interface
+    static int slab_num() {
+        return Instance_().mSlabNum_d;
+    }
+
+    // only free list, not include uncarved area of current slab
+    static int free_block_num() {
+        return Instance_().mFreeBlockNum_d;
+    }
+
+protected:
+    Link_e mFreeList_d;
+    Link_e mSlabList_d;
+    char *mCurr_d, *mEnd_d;
+    int mSlabNum_d;
+    int mFreeBlockNum_d;
+
+    static PoolAlloc & Instance_() {
+        static PoolAlloc pool;
+        return pool;
+    }
+
+    bool new_slab_d() {
+        char *slabPtr = static_cast<char *>(Upstream::allocate(SLAB_SIZE));
+        if (slabPtr == nullptr) return false;
+
+        Link_e::add(&mSlabList_d, reinterpret_cast<Link_e *>(slabPtr));
+        mSlabNum_d++;
+
+        // Note: tail of old slab(< POOL_BLOCK_SIZE) is dropped
+        mCurr_d = slabPtr + SLAB_HEADER_SIZE;
+        mEnd_d = slabPtr + SLAB_SIZE;
+
+        return true;
+    }
+};
+
+}
+
+#endif
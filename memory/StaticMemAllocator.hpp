@@ -27,17 +27,32 @@ namespace dstruct {
 
 
 /*
-mFreeMemList_d: when SMA_MEM_ALIGN equal 8
-    +---------------------------+
-    | 0 | 1 | ......... |n-1| X | - index
-    +---------------------------+
-    | l | l | ......... | l | p | - list-head 
-    ----------------------------+
-      |                  |     |
-      V                  V     V 
-    list                list  list-mem-pool            - list
-    Link_e             Link_e  MemBlock_e              - list-node
-    8*(0+1)             8*n    MemBlock_e->data        - mem-block size
+mFreeMemList_d: quick-mem, when SMA_MEM_ALIGN equal 8
+    +-----------------------+
+    | 0 | 1 | ......... |n-1| - index
+    +-----------------------+
+    | l | l | ......... | l | - list-head
+    +-----------------------+
+      |                  |
+      V                  V
+    list                list    - list
+    Link_e             Link_e   - list-node
+    8*(0+1)             8*n     - mem-block size
+
+mMemPoolList_d: mem-pool(bytes > MAX_BLOCK_SIZE), two-level segregated fit
+    fl = log2(size), sl = next SL_INDEX_BITS bits of size
+    +---------------------------------+
+    | fl0: sl0 | sl1 | ....... | sl7 |  - [2^k, 2^(k+1)) split to 8 lists, k = log2(MAX_BLOCK_SIZE)
+    | fl1: sl0 | sl1 | ....... | sl7 |
+    | ....                            |
+    +---------------------------------+
+      |
+      V
+    list - MemBlock_e, MemBlock_e->data is mem-block size
+
+bitmap: bit == 1 <==> list isn't empty, so search a list by find-first-set(ctz)
+    quick-mem: mQuickSummary_d(which word) -> mQuickBitmap_d[word](which list)
+    mem-pool:  mPoolFLBitmap_d(fl) -> mPoolSLBitmap_d[fl](sl)
 */
 
 // Note: request MEMORY_SIZE % SMA_MEM_ALIGN == 0
@@ -54,12 +69,25 @@ private:
     */
     using MemBlock_e = dstruct::EmbeddedListNode_<int, Link_e>;
 
+    constexpr static int LOG2_(int n) {
+        return n <= 1 ? 0 : 1 + LOG2_(n / 2);
+    }
+
+    constexpr static int QUICK_LIST_NUM = MAX_BLOCK_SIZE / SMA_MEM_ALIGN;
+    constexpr static int QUICK_BITMAP_NUM = (QUICK_LIST_NUM + 31) / 32;
+    constexpr static int SL_INDEX_BITS = 3;
+    constexpr static int SL_LIST_NUM = 1 << SL_INDEX_BITS;
+    constexpr static int FL_LIST_NUM = LOG2_(MEMORY_SIZE) - LOG2_(MAX_BLOCK_SIZE) + 1;
+
+    static_assert(MAX_BLOCK_SIZE >= SMA_MEM_ALIGN, "MAX_BLOCK_SIZE < SMA_MEM_ALIGN");
+    static_assert(QUICK_BITMAP_NUM <= 32, "MAX_BLOCK_SIZE out of quick-mem bitmap range");
+
 private: // big five
-    StaticMemAllocator() : mFreeMemSize_d { MEMORY_SIZE }, mMemoryPool_d { 0 }, mFreeMemList_d(Link_e{ nullptr }) {
-        auto mbPtr = reinterpret_cast<MemBlock_e *>(&mMemoryPool_d);
-        mbPtr->data = MEMORY_SIZE;
-        mbPtr->link.next = nullptr;
-        mFreeMemList_d[-1].next = MemBlock_e::to_link(mbPtr);
+    StaticMemAllocator() :
+        mFreeMemSize_d { MEMORY_SIZE }, mMemoryPool_d { 0 },
+        mFreeMemList_d(Link_e{ nullptr }), mMemPoolList_d(Link_e{ nullptr }),
+        mQuickSummary_d { 0 }, mQuickBitmap_d(0), mPoolFLBitmap_d { 0 }, mPoolSLBitmap_d(0) {
+        insert_mem_block_to_list_d(mMemoryPool_d, MEMORY_SIZE);
     }
 
     StaticMemAllocator(const StaticMemAllocator&) = delete;
@@ -85,26 +113,29 @@ public: // mem-manager interface
     }
 
     static int max_free_mblock_size() {
-        // check - mem-pool
-        auto  *linkPtr = Instance_().mFreeMemList_d.back().next;
-        int maxSize = 0;
-        while (linkPtr != nullptr) {
-            auto mbPtr = MemBlock_e::to_node(linkPtr);
-            if (maxSize < mbPtr->data) maxSize = mbPtr->data;
-            linkPtr = linkPtr->next;
+        auto &sma = Instance_();
+
+        // check - mem-pool: only need to check the highest non-empty list
+        if (sma.mPoolFLBitmap_d != 0) {
+            int fl = dstruct::floor_log2(sma.mPoolFLBitmap_d);
+            int sl = dstruct::floor_log2(sma.mPoolSLBitmap_d[fl]);
+            auto *linkPtr = sma.mMemPoolList_d[fl * SL_LIST_NUM + sl].next;
+            int maxSize = 0;
+            while (linkPtr != nullptr) {
+                auto mbPtr = MemBlock_e::to_node(linkPtr);
+                if (maxSize < mbPtr->data) maxSize = mbPtr->data;
+                linkPtr = linkPtr->next;
+            }
+            return maxSize;
         }
 
-        if (maxSize > 0) return maxSize;
-
         // check - quick-mem
-        int listIndex = Instance_().mFreeMemList_d.size() - 1 - 1;
-        while (listIndex >= 0 && Instance_().mFreeMemList_d[listIndex].next == nullptr) {
-            listIndex--;
+        if (sma.mQuickSummary_d != 0) {
+            int word = dstruct::floor_log2(sma.mQuickSummary_d);
+            return INDEX_TO_SIZE_(word * 32 + dstruct::floor_log2(sma.mQuickBitmap_d[word]));
         }
 
-        maxSize = INDEX_TO_SIZE_(listIndex);
-
-        return maxSize;
+        return 0;
     }
 
     static void memory_merge() {
@@ -112,34 +143,48 @@ public: // mem-manager interface
     }
 
     static void dump() {
+        auto &sma = Instance_();
         SMA_LOGD("sma dump(total %d, used %d, free %d):",
-            MEMORY_SIZE, MEMORY_SIZE - Instance_().mFreeMemSize_d, Instance_().mFreeMemSize_d);
+            MEMORY_SIZE, MEMORY_SIZE - sma.mFreeMemSize_d, sma.mFreeMemSize_d);
         int verifyFreeMemSize = 0;
-        for (int i = 0; i < Instance_().mFreeMemList_d.size(); i++) {
-            Link_e *mbPtr = Instance_().mFreeMemList_d[i].next;
+        for (int i = 0; i < QUICK_LIST_NUM; i++) {
+            Link_e *mbPtr = sma.mFreeMemList_d[i].next;
             int lIndex = 0;
             while (mbPtr != nullptr) {
-                int size = 0;
-                if (i == Instance_().mFreeMemList_d.size() - 1) {
-                    size = MemBlock_e::to_node(mbPtr)->data;
-                } else {
-                    size = INDEX_TO_SIZE_(i);
-                }
-                SMA_LOGD("\tt-index: %d, l-index %d, addr %p, size %d", i, lIndex++, mbPtr, size);
+                SMA_LOGD("\tt-index: %d, l-index %d, addr %p, size %d", i, lIndex, mbPtr, INDEX_TO_SIZE_(i));
+                lIndex++;
+                verifyFreeMemSize += INDEX_TO_SIZE_(i);
+                mbPtr = mbPtr->next;
+            }
+        }
+
+        for (int i = 0; i < FL_LIST_NUM * SL_LIST_NUM; i++) {
+            Link_e *mbPtr = sma.mMemPoolList_d[i].next;
+            int lIndex = 0;
+            while (mbPtr != nullptr) {
+                int size = MemBlock_e::to_node(mbPtr)->data;
+                SMA_LOGD("\tp-index: %d-%d, l-index %d, addr %p, size %d",
+                    i / SL_LIST_NUM, i % SL_LIST_NUM, lIndex, mbPtr, size);
+                lIndex++;
                 verifyFreeMemSize += size;
                 mbPtr = mbPtr->next;
             }
         }
 
-        SMA_LOGD("\tfree-mem verify: %d == %d", Instance_().mFreeMemSize_d, verifyFreeMemSize);
+        SMA_LOGD("\tfree-mem verify: %d == %d", sma.mFreeMemSize_d, verifyFreeMemSize);
 
-        DSTRUCT_CRASH(Instance_().mFreeMemSize_d != verifyFreeMemSize);
+        DSTRUCT_CRASH(sma.mFreeMemSize_d != verifyFreeMemSize);
     }
 
 protected:
     int mFreeMemSize_d;
-    char mMemoryPool_d[MEMORY_SIZE];
-    dstruct::Array<Link_e, MAX_BLOCK_SIZE / SMA_MEM_ALIGN + 1/*MemPoolManager*/> mFreeMemList_d;
+    alignas(SMA_MEM_ALIGN) char mMemoryPool_d[MEMORY_SIZE];
+    dstruct::Array<Link_e, QUICK_LIST_NUM> mFreeMemList_d;
+    dstruct::Array<Link_e, FL_LIST_NUM * SL_LIST_NUM> mMemPoolList_d;
+    unsigned int mQuickSummary_d;
+    dstruct::Array<unsigned int, QUICK_BITMAP_NUM> mQuickBitmap_d;
+    unsigned int mPoolFLBitmap_d;
+    dstruct::Array<unsigned int, FL_LIST_NUM> mPoolSLBitmap_d;
 
     static StaticMemAllocator & Instance_() {
         static StaticMemAllocator sma; // create & manage static memory area
@@ -154,6 +199,13 @@ protected:
         return (index + 1) * SMA_MEM_ALIGN;
     }
 
+    // request: bytes > MAX_BLOCK_SIZE
+    static void SIZE_TO_POOL_INDEX_(int bytes, int &fl, int &sl) {
+        int log2 = dstruct::floor_log2(bytes);
+        fl = log2 - LOG2_(MAX_BLOCK_SIZE);
+        sl = (bytes >> (log2 - SL_INDEX_BITS)) & (SL_LIST_NUM - 1);
+    }
+
     void * allocate_d(int bytes) {
 
         MemBlock_e targetMemBlockIndex;
@@ -194,157 +246,196 @@ protected: // quick allocator
     MemBlock_e quick_mem_allocate_d(int bytes) {
 
         MemBlock_e targetMemIndex;
-
-        bytes = MEM_ALIGN_ROUND_UP(bytes);
+        targetMemIndex.link.next = nullptr;
+        targetMemIndex.data = 0;
 
         int freeMemListIndex = SIZE_TO_INDEX_(bytes);
-        while ( // search free memory block
-            freeMemListIndex < mFreeMemList_d.size() - 1 &&
-            mFreeMemList_d[freeMemListIndex].next == nullptr
-        ) freeMemListIndex++;
-
-        if (freeMemListIndex == mFreeMemList_d.size() - 1) {
-            targetMemIndex.link.next = nullptr;
-            targetMemIndex.data = 0;
-        } else {
-            // fill mem block info(addr and size) to targetMemIndex
-            auto targetMemBlockLinkPtr = mFreeMemList_d[freeMemListIndex].next;
-            targetMemIndex.link.next = targetMemBlockLinkPtr;
-            targetMemIndex.data = INDEX_TO_SIZE_(freeMemListIndex);
-            // delete target memory block from quick-mem
-            mFreeMemList_d[freeMemListIndex].next = targetMemBlockLinkPtr->next;
+
+        // search free memory block: first non-empty list >= freeMemListIndex
+        int word = freeMemListIndex / 32;
+        unsigned int bitmap = mQuickBitmap_d[word] & (~0u << (freeMemListIndex % 32));
+        if (bitmap == 0) {
+            unsigned int summary = word + 1 < QUICK_BITMAP_NUM ? mQuickSummary_d & (~0u << (word + 1)) : 0;
+            if (summary == 0) return targetMemIndex;
+            word = dstruct::count_trailing_zeros(summary);
+            bitmap = mQuickBitmap_d[word];
+        }
+        freeMemListIndex = word * 32 + dstruct::count_trailing_zeros(bitmap);
+
+        // fill mem block info(addr and size) to targetMemIndex
+        auto targetMemBlockLinkPtr = mFreeMemList_d[freeMemListIndex].next;
+        targetMemIndex.link.next = targetMemBlockLinkPtr;
+        targetMemIndex.data = INDEX_TO_SIZE_(freeMemListIndex);
+        // delete target memory block from quick-mem
+        mFreeMemList_d[freeMemListIndex].next = targetMemBlockLinkPtr->next;
+        if (mFreeMemList_d[freeMemListIndex].next == nullptr) {
+            mQuickBitmap_d[word] &= ~(1u << (freeMemListIndex % 32));
+            if (mQuickBitmap_d[word] == 0) mQuickSummary_d &= ~(1u << word);
         }
 
         return targetMemIndex;
     }
 
-    void quick_mem_memory_merge_d() {
-        for (int i = 0; i < mFreeMemList_d.size() - 1; i++) {
-            auto firstMemLinkPtr = &(mFreeMemList_d[i]);
-            Link_e *firstMemBlockPtr = firstMemLinkPtr->next;
-            Link_e *secondMemBlockPtr = nullptr;
-            while (firstMemBlockPtr) {
-                secondMemBlockPtr = firstMemBlockPtr->next;
-                if (SMA_ADDRESS_EQUAL(reinterpret_cast<char *>(firstMemBlockPtr) + (i + 1) * SMA_MEM_ALIGN, secondMemBlockPtr)) {
-                    // merge firstMemBlockPtr and secondMemBlockPtr
-                    firstMemLinkPtr->next = secondMemBlockPtr->next; // delete first/secondMemBlockPtr from list[i]
-                    int listIndex = i * 2 + 1;
-                    insert_mem_block_to_list_d(firstMemBlockPtr, INDEX_TO_SIZE_(listIndex));
-                } else {
-                    bool secondMemBlockFlag = false;
-                    for (int j = i + 1; j < mFreeMemList_d.size() - 1 && !secondMemBlockFlag; j++) {
-                        auto secondMemLinkPtr = &(mFreeMemList_d[j]);
-                        secondMemBlockPtr = secondMemLinkPtr->next;
-                        while (secondMemBlockPtr != nullptr) {
-                            /*                         +-----+ 
-                              xUp                -->   |     |
-                              firstMemBlockPtr   -->   |     |
-                              xDown              -->   |     |
-                                                       +-----+
-                            */
-                            void *addrUP = reinterpret_cast<char *>(firstMemBlockPtr) - (j + 1) * SMA_MEM_ALIGN;
-                            void *addrDown = reinterpret_cast<char *>(firstMemBlockPtr) + (i + 1) * SMA_MEM_ALIGN;
-
-                            if (SMA_ADDRESS_EQUAL(addrUP, secondMemBlockPtr) || SMA_ADDRESS_EQUAL(addrDown, secondMemBlockPtr)) { // check merge-able
-                                firstMemLinkPtr->next = firstMemBlockPtr->next; // delete firstMemBlock from list[i]
-                                secondMemLinkPtr->next = secondMemBlockPtr->next; // delete secondMemBlock from list[j]
-                                insert_mem_block_to_list_d(
-                                    firstMemBlockPtr < secondMemBlockPtr ? firstMemBlockPtr : secondMemBlockPtr,
-                                    INDEX_TO_SIZE_(i + j + 1)
-                                );
-                                secondMemBlockFlag = true;
-                                break;
-                            }
-
-                            if (firstMemBlockPtr > secondMemBlockPtr) break;
-
-                            secondMemLinkPtr = secondMemBlockPtr;
-                            secondMemBlockPtr = secondMemLinkPtr->next;
-                        }
-                    }
-
-                    if (secondMemBlockFlag == false) // update firstMemLinkPtr
-                        firstMemLinkPtr = firstMemBlockPtr;
-                }
-
-                firstMemBlockPtr = firstMemLinkPtr->next;
-            }
-        }
-    }
-
 protected: // memory pool manager
-    // manage big-mem-block: bytes > MAX_BLOCK_SIZE
+    // manage big-mem-block: bytes > MAX_BLOCK_SIZE (or quick-mem is empty)
     MemBlock_e mem_pool_allocate_d(int bytes) {
 
         MemBlock_e targetMemIndex;
+        targetMemIndex.link.next = nullptr;
+        targetMemIndex.data = 0;
 
         bytes = MEM_ALIGN_ROUND_UP(bytes);
 
-        Link_e *preLinkPtr = &(mFreeMemList_d[-1]);
-        MemBlock_e *targetMemBlockPtr = nullptr;
-        while (preLinkPtr->next != nullptr) { // FFMA - First Fit
-            targetMemBlockPtr = MemBlock_e::to_node(preLinkPtr->next);
-            if (targetMemBlockPtr->data >= bytes)
-                break;
-            preLinkPtr = preLinkPtr->next;
+        int fl = 0, sl = 0;
+        if (bytes > MAX_BLOCK_SIZE) {
+            // round up to next list, every block in it and after it is big enough
+            SIZE_TO_POOL_INDEX_(bytes + (1 << (dstruct::floor_log2(bytes) - SL_INDEX_BITS)) - 1, fl, sl);
         }
 
-        if (preLinkPtr->next != nullptr) {
+        Link_e *preLinkPtr = nullptr;
+
+        if (fl < FL_LIST_NUM) { // good fit - O(1)
+            unsigned int bitmap = mPoolSLBitmap_d[fl] & (~0u << sl);
+            if (bitmap == 0) {
+                unsigned int flBitmap = fl + 1 < FL_LIST_NUM ? mPoolFLBitmap_d & (~0u << (fl + 1)) : 0;
+                if (flBitmap != 0) {
+                    fl = dstruct::count_trailing_zeros(flBitmap);
+                    bitmap = mPoolSLBitmap_d[fl];
+                }
+            }
+            if (bitmap != 0) {
+                sl = dstruct::count_trailing_zeros(bitmap);
+                preLinkPtr = &(mMemPoolList_d[fl * SL_LIST_NUM + sl]);
+            }
+        }
+
+        if (preLinkPtr == nullptr && bytes > MAX_BLOCK_SIZE) {
+            // FFMA - First Fit in the list of bytes (only near exhausted)
+            SIZE_TO_POOL_INDEX_(bytes, fl, sl);
+            Link_e *linkPtr = &(mMemPoolList_d[fl * SL_LIST_NUM + sl]);
+            while (linkPtr->next != nullptr && MemBlock_e::to_node(linkPtr->next)->data < bytes) {
+                linkPtr = linkPtr->next;
+            }
+            if (linkPtr->next != nullptr) preLinkPtr = linkPtr;
+        }
+
+        if (preLinkPtr != nullptr) {
+            MemBlock_e *targetMemBlockPtr = MemBlock_e::to_node(preLinkPtr->next);
             // fill mem-block to targetMemIndex
             targetMemIndex.data = targetMemBlockPtr->data;
             targetMemIndex.link.next = MemBlock_e::to_link(targetMemBlockPtr);
             // delete memory block from mem-pool
             preLinkPtr->next = targetMemBlockPtr->link.next;
-        } else { // allocate failed
-            targetMemIndex.link.next = nullptr;
+            if (mMemPoolList_d[fl * SL_LIST_NUM + sl].next == nullptr) {
+                mPoolSLBitmap_d[fl] &= ~(1u << sl);
+                if (mPoolSLBitmap_d[fl] == 0) mPoolFLBitmap_d &= ~(1u << fl);
+            }
         }
 
         return targetMemIndex;
     }
 
-    void mem_pool_memory_merge_d() {
-        MemBlock_e *mbPtr = MemBlock_e::to_node(mFreeMemList_d.back().next);
-        while (mbPtr != nullptr) {
-            auto next = MemBlock_e::to_node(mbPtr->link.next);
-            if (SMA_ADDRESS_EQUAL(reinterpret_cast<char *>(mbPtr) + mbPtr->data, next)) {
-                // merge next to mbPtr
-                mbPtr->data += next->data;
-                mbPtr->link.next = next->link.next;
-            } else {
-                mbPtr = next;
-            }
-        }
-    }
-
 protected: // common
     void insert_mem_block_to_list_d(void *addr, int size) {
 
         if (size <= 0) return;
 
-        int ListIndex = SIZE_TO_INDEX_(size);
-
-        if (ListIndex >= mFreeMemList_d.size() - 1) {
-            ListIndex = mFreeMemList_d.size() - 1;
+        if (size <= MAX_BLOCK_SIZE) {
+            int listIndex = SIZE_TO_INDEX_(size);
+            Link_e::add(&(mFreeMemList_d[listIndex]), static_cast<Link_e *>(addr));
+            mQuickBitmap_d[listIndex / 32] |= 1u << (listIndex % 32);
+            mQuickSummary_d |= 1u << (listIndex / 32);
+        } else {
+            int fl, sl;
+            SIZE_TO_POOL_INDEX_(size, fl, sl);
+            Link_e::add(&(mMemPoolList_d[fl * SL_LIST_NUM + sl]), static_cast<Link_e *>(addr));
+            // insert to MemoryPool, so need to set mem-block size
+            MemBlock_e::to_node(static_cast<Link_e *>(addr))->data = size;
+            mPoolSLBitmap_d[fl] |= 1u << sl;
+            mPoolFLBitmap_d |= 1u << fl;
         }
 
-        Link_e *freeMemLinkPtr = &(mFreeMemList_d[ListIndex]);
-        while (freeMemLinkPtr->next != nullptr && addr > freeMemLinkPtr->next) {
-            freeMemLinkPtr = freeMemLinkPtr->next;
+    }
+
+    // sort by address - merge sort, list end with nullptr
+    static Link_e * sort_mem_block_list_(Link_e *list) {
+        if (list == nullptr || list->next == nullptr) return list;
+
+        Link_e *slow = list, *fast = list->next;
+        while (fast != nullptr && fast->next != nullptr) {
+            slow = slow->next;
+            fast = fast->next->next;
         }
 
-        Link_e::add(freeMemLinkPtr, static_cast<Link_e *>(addr));
+        Link_e *right = sort_mem_block_list_(slow->next);
+        slow->next = nullptr;
+        Link_e *left = sort_mem_block_list_(list);
 
-        if (ListIndex == mFreeMemList_d.size() - 1) {
-            // insert to MemoryPool, so need to set mem-block size
-            MemBlock_e *mbPtr = MemBlock_e::to_node(freeMemLinkPtr->next);
-            mbPtr->data = size;
+        Link_e head { nullptr }, *tail = &head;
+        while (left != nullptr && right != nullptr) {
+            if (left < right) {
+                tail->next = left; left = left->next;
+            } else {
+                tail->next = right; right = right->next;
+            }
+            tail = tail->next;
         }
+        tail->next = left != nullptr ? left : right;
 
+        return head.next;
     }
 
+    // 1. take all mem-block out and sort every list by address
+    // 2. visit mem-block by address order(k-way merge), merge adjacent block
     void memory_merge_d() {
-        quick_mem_memory_merge_d();
-        mem_pool_memory_merge_d();
+        // [0, QUICK_LIST_NUM): quick-mem, [QUICK_LIST_NUM]: mem-pool
+        dstruct::Array<Link_e *, QUICK_LIST_NUM + 1> lists(nullptr);
+
+        for (int i = 0; i < QUICK_LIST_NUM; i++) {
+            lists[i] = sort_mem_block_list_(mFreeMemList_d[i].next);
+            mFreeMemList_d[i].next = nullptr;
+        }
+
+        for (int i = 0; i < FL_LIST_NUM * SL_LIST_NUM; i++) {
+            Link_e *linkPtr = mMemPoolList_d[i].next;
+            while (linkPtr != nullptr) {
+                Link_e *next = linkPtr->next;
+                linkPtr->next = lists[-1];
+                lists[-1] = linkPtr;
+                linkPtr = next;
+            }
+            mMemPoolList_d[i].next = nullptr;
+        }
+        lists[-1] = sort_mem_block_list_(lists[-1]);
+
+        mQuickSummary_d = mPoolFLBitmap_d = 0;
+        for (auto &bitmap : mQuickBitmap_d) bitmap = 0;
+        for (auto &bitmap : mPoolSLBitmap_d) bitmap = 0;
+
+        char *mergeAddr = nullptr;
+        int mergeSize = 0;
+        while (true) {
+            int target = -1;
+            for (int i = 0; i <= QUICK_LIST_NUM; i++) {
+                if (lists[i] != nullptr && (target < 0 || lists[i] < lists[target])) target = i;
+            }
+
+            if (target < 0) break;
+
+            Link_e *mbPtr = lists[target];
+            int size = target == QUICK_LIST_NUM ? MemBlock_e::to_node(mbPtr)->data : INDEX_TO_SIZE_(target);
+            lists[target] = mbPtr->next;
+
+            if (SMA_ADDRESS_EQUAL(mergeAddr + mergeSize, mbPtr)) {
+                mergeSize += size;
+            } else {
+                insert_mem_block_to_list_d(mergeAddr, mergeSize);
+                mergeAddr = reinterpret_cast<char *>(mbPtr);
+                mergeSize = size;
+            }
+        }
+
+        insert_mem_block_to_list_d(mergeAddr, mergeSize);
     }
 
 };
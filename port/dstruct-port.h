@@ -41,6 +41,16 @@ struct Alloc {
 #define DSTRUCT_ASSERT(expr) DSTRUCT_CRASH(!(expr))
 #endif
 
+// for padding of concurrent dstruct, avoid false sharing
+#ifndef DSTRUCT_CACHE_LINE_SIZE
+#define DSTRUCT_CACHE_LINE_SIZE 64
+#endif
+
+// SIMD: auto-detected, define DSTRUCT_DISABLE_SIMD to use the portable scalar version
+#if !defined(DSTRUCT_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define DSTRUCT_SIMD_SSE2
+#endif
+
 struct DStructPlacementNewFlag { };
 inline void * operator new(dstruct::port::size_t sz, void *ptr, DStructPlacementNewFlag *) noexcept { return ptr; }
 // void operator delete(void *ptr, DStructPlacementNewFlag *) {  } haven't used
@@ -20,27 +20,22 @@
 #endif
 
 #include <memory/StaticMemAllocator.hpp>
+#include <memory/BoundaryTagMemAllocator.hpp>
 
 namespace dstruct {
 namespace port {
 
 using size_t = long unsigned int;
-using DefaultSMA = StaticMemAllocator<1024 * 1024>; // 1M
+using DefaultSMA = BoundaryTagMemAllocator<1024 * 1024>; // 1M
 
 static void * allocate(int bytes) {
     SMA_LOGD("allocate-start: request %d", bytes);
 #ifdef ENABLE_SMA_DUMP
     DefaultSMA::dump();
 #endif
-    auto *memPtr = DefaultSMA::allocate(bytes);
-    if (memPtr == nullptr) {
-        SMA_LOGD("memory_merge");
-        DefaultSMA::memory_merge();
-#ifdef ENABLE_SMA_DUMP
-        DefaultSMA::dump();
-#endif
-        SMA_MEM_VERIFY(memPtr = DefaultSMA::allocate(bytes));
-    }
+    void *memPtr = nullptr;
+    // free blocks are coalesced when deallocate, so needn't memory_merge and retry
+    SMA_MEM_VERIFY(memPtr = DefaultSMA::allocate(bytes));
 #ifdef ENABLE_SMA_DUMP
     DefaultSMA::dump();
 #endif
@@ -41,9 +41,32 @@ struct Alloc {
     static void * allocate(int bytes);
     static void deallocate(void *addr, int bytes);
 };
+
+// Instance Alloc: stateful, the instance is passed to dstruct at construction
+// (e.g. an arena) - dstruct::Vector<int, Arena> vec(arena);
+struct InstanceAlloc {
+    using InstanceAllocTag = void;
+    void * allocate(int bytes);
+    void deallocate(void *addr, int bytes);
+};
 */
-template <typename T, typename Alloc>
+template <typename Alloc>
+struct IsInstanceAlloc {
+private:
+    template <typename A> static char _check(typename A::InstanceAllocTag *);
+    template <typename A> static long _check(...);
+public:
+    const static bool value = sizeof(_check<Alloc>(nullptr)) == sizeof(char);
+};
+
+template <typename T, typename Alloc, bool = IsInstanceAlloc<Alloc>::value>
 struct AllocSpec {
+    AllocSpec() = default;
+    AllocSpec(Alloc &) { }
+
+    template <typename U>
+    AllocSpec(const AllocSpec<U, Alloc> &) { }
+
     static T *allocate(int n = 1) {
         return static_cast<T *>(Alloc::allocate(n * sizeof(T)));
     }
@@ -51,6 +74,45 @@ struct AllocSpec {
     static void deallocate(T *ptr, int n = 1) {
         Alloc::deallocate(ptr, n * sizeof(T));
     }
+
+    Alloc * _alloc_instance() const { return nullptr; }
+
+    // copy: keep self's alloc-instance, use src's if haven't
+    void _alloc_inherit(const AllocSpec &) { }
+    // move: memory owned by src's alloc-instance
+    void _alloc_take(const AllocSpec &) { }
+};
+
+template <typename T, typename Alloc>
+struct AllocSpec<T, Alloc, true> {
+    AllocSpec() : mAllocPtr_d { nullptr } { }
+    AllocSpec(Alloc &alloc) : mAllocPtr_d { &alloc } { }
+
+    // rebind, e.g. AllocSpec<T, Alloc> -> AllocSpec<Node, Alloc>
+    template <typename U>
+    AllocSpec(const AllocSpec<U, Alloc> &as) : mAllocPtr_d { as._alloc_instance() } { }
+
+    T *allocate(int n = 1) const {
+        DSTRUCT_CRASH(mAllocPtr_d == nullptr); // haven't bind alloc-instance
+        return static_cast<T *>(mAllocPtr_d->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *ptr, int n = 1) const {
+        mAllocPtr_d->deallocate(ptr, n * sizeof(T));
+    }
+
+    Alloc * _alloc_instance() const { return mAllocPtr_d; }
+
+    void _alloc_inherit(const AllocSpec &as) {
+        if (mAllocPtr_d == nullptr) mAllocPtr_d = as.mAllocPtr_d;
+    }
+
+    void _alloc_take(const AllocSpec &as) {
+        mAllocPtr_d = as.mAllocPtr_d;
+    }
+
+protected:
+    Alloc *mAllocPtr_d;
 };
 
 
@@ -115,8 +177,9 @@ protected: // member var
 
 //////////////// - Data Structures
 
+// Note: inherit AllocSpec(empty for static Alloc) to hold alloc-instance
 template <typename T, typename Alloc, typename Iterator, typename ConstIterator>
-class DStructTypeSpec {
+class DStructTypeSpec : protected AllocSpec<T, Alloc> {
 // Type Spec
 public: // common type
     using ValueType            = T;
@@ -129,11 +192,19 @@ public: // common type
 public: // iterator type
     using IteratorType         = Iterator;
     using ConstIteratorType    = ConstIterator;
-protected: // alloc type
+public: // alloc type
+    using AllocType            = Alloc;
+protected:
     using Alloc_               = AllocSpec<T, Alloc>;
 private:
     using Self               = DStructTypeSpec;
 
+protected:
+    DStructTypeSpec() = default;
+    DStructTypeSpec(Alloc &alloc) : Alloc_ { alloc } { }
+    template <typename U>
+    DStructTypeSpec(const AllocSpec<U, Alloc> &as) : Alloc_ { as } { }
+
 /* pls: according to your dstruct impl them
 public: // bigfive
     Self();
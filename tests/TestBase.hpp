@@ -33,6 +33,8 @@ public:
         TEST_LOG("Copy Destory");
     }
 
+    Destory & operator=(const Destory &) = default;
+
     ~Destory() {
         mCnt_e--;
         DSTRUCT_ASSERT(mCnt_e == 0);
@@ -42,6 +44,55 @@ private:
     int mCnt_e;
 };
 
+// deterministic LCG for the randomized tests
+struct Random {
+    unsigned int seed;
+
+    Random(unsigned int s = 2023) : seed { s } { }
+
+    unsigned int next() {
+        seed = seed * 1103515245 + 12345;
+        return seed;
+    }
+};
+
+struct NoInvariant {
+    template <typename Set>
+    bool operator()(const Set &) const { return true; }
+};
+
+// random push/pop of keys in [0, keyRange) on an empty set, push : pop = pushWeight : 1
+// size is checked every op, contains(all keys) and invariant(set) every 1000 ops
+template <typename Set, typename Invariant = NoInvariant>
+static void test_random_set_op(Set &set, int keyRange, int opNum, int pushWeight = 2,
+    Invariant invariant = Invariant()) {
+    using KeyType = typename Set::ValueType;
+
+    DSTRUCT_ASSERT(set.empty());
+    dstruct::Vector<bool> exist(keyRange, false);
+    int num = 0;
+    Random random;
+
+    for (int i = 0; i < opNum; i++) {
+        unsigned int r = random.next();
+        KeyType key = static_cast<KeyType>((r >> 8) % keyRange);
+        if ((r >> 4) % (pushWeight + 1)) {
+            if (!exist[key]) num++;
+            exist[key] = true;
+            set.push(key);
+        } else {
+            if (exist[key]) num--;
+            exist[key] = false;
+            set.pop(key);
+        }
+        DSTRUCT_ASSERT(static_cast<int>(set.size()) == num);
+        if (i % 1000 == 0 || i == opNum - 1) {
+            for (int k = 0; k < keyRange; k++) DSTRUCT_ASSERT(set.contains(static_cast<KeyType>(k)) == exist[k]);
+            DSTRUCT_ASSERT(invariant(set));
+        }
+    }
+}
+
 template <typename DStruct>
 static void test_destroy() {
     DStruct ds;
@@ -61,7 +112,7 @@ static void test_destroy() {
     DSTRUCT_ASSERT(ds.empty());
 }
 
-static void test_arr_destroy() {
+inline void test_arr_destroy() {
 
     { // test auto
         dstruct::Array<Destory, 10> ds1;
@@ -82,14 +133,14 @@ static void test_arr_destroy() {
     //std::cout << std::endl;
 }
 
-static void test_sma_allocator() {
+inline void test_sma_allocator() {
     using MyMemAlloc = dstruct::StaticMemAllocator<1024, 1024>; // define a 1024byte static allocator
 
 // allocate/release memory - test
 
     int memSize = 1024;
     dstruct::Array<void *, 8> memArr;
-    for (int i = 0; i < memArr.size(); i++) {
+    for (int i = 0; i < static_cast<int>(memArr.size()); i++) {
         memArr[i] = MyMemAlloc::allocate(memSize /= 2);
         if (i > 0) {
             TEST_LOG("%p %p", memArr[i - 1], memArr[i]);
@@ -99,7 +150,7 @@ static void test_sma_allocator() {
 
     // release all memory
     memSize = 1024;
-    for (int i = 0; i < memArr.size(); i++) {
+    for (int i = 0; i < static_cast<int>(memArr.size()); i++) {
         MyMemAlloc::deallocate(memArr[i], memSize /= 2);
     }
 
@@ -122,7 +173,7 @@ static void test_sma_allocator() {
     {   //    list-index    0  3   7   63   1   31   15   0
         int memAllocSeq[8] {8, 32, 64, 512, 16, 256, 128, 8};
 
-        for (int i = 0; i < memArr.size(); i++) {
+        for (int i = 0; i < static_cast<int>(memArr.size()); i++) {
             memArr[i] = MyMemAlloc::allocate(memAllocSeq[i]);
             if (i > 0) {
                 TEST_LOG("%p %p", memArr[i - 1], memArr[i]);
@@ -130,7 +181,7 @@ static void test_sma_allocator() {
             }
         }
 
-        for (int i = 0; i < memArr.size(); i++) {
+        for (int i = 0; i < static_cast<int>(memArr.size()); i++) {
             MyMemAlloc::deallocate(memArr[i], memAllocSeq[i]);
         }
 
@@ -142,6 +193,110 @@ static void test_sma_allocator() {
     }
 }
 
+// mem-pool size class - test: sizes around the second-level(sl) list boundaries
+inline void test_sma_allocator_size_class() {
+    using MyMemAlloc = dstruct::StaticMemAllocator<4096, 128>;
+
+    // [256, 512) split to 8 lists, 32 bytes per list
+    const int memNum = 12;
+    int memAllocSeq[memNum] { 136, 152, 160, 168, 248, 256, 264, 280, 288, 296, 504, 512 };
+    dstruct::Array<char *, memNum> memArr;
+
+    for (int i = 0; i < memNum; i++) {
+        memArr[i] = static_cast<char *>(MyMemAlloc::allocate(memAllocSeq[i]));
+        DSTRUCT_ASSERT(memArr[i] != nullptr);
+        for (int j = 0; j < memAllocSeq[i]; j++) memArr[i][j] = static_cast<char>(i);
+    }
+
+    // every block is big enough: no overlap with the others
+    for (int i = 0; i < memNum; i++) {
+        for (int j = 0; j < memAllocSeq[i]; j++) DSTRUCT_ASSERT(memArr[i][j] == static_cast<char>(i));
+    }
+
+    // free a 288 bytes block(the first of its list), it can't merge with the neighbors
+    char *freeBlock = memArr[8];
+    MyMemAlloc::deallocate(freeBlock, 288);
+
+    // 296 need the next list, must not get the 288 bytes block
+    char *mem296 = static_cast<char *>(MyMemAlloc::allocate(296));
+    DSTRUCT_ASSERT(mem296 != nullptr && mem296 != freeBlock);
+
+    // 280 round up to the list of 288, good fit
+    memArr[8] = static_cast<char *>(MyMemAlloc::allocate(280));
+    DSTRUCT_ASSERT(memArr[8] == freeBlock);
+    memAllocSeq[8] = 280;
+
+    MyMemAlloc::deallocate(mem296, 296);
+    for (int i = 0; i < memNum; i++) {
+        MyMemAlloc::deallocate(memArr[i], memAllocSeq[i]);
+    }
+    MyMemAlloc::dump();
+    DSTRUCT_ASSERT(MyMemAlloc::free_mem_size() == 4096);
+
+    MyMemAlloc::memory_merge();
+    DSTRUCT_ASSERT(MyMemAlloc::max_free_mblock_size() == 4096);
+}
+
+inline void test_boundary_tag_sma_allocator() {
+    using MyMemAlloc = dstruct::BoundaryTagMemAllocator<1024, 128>; // define a 1024byte static allocator
+
+    int freeMemSize = MyMemAlloc::free_mem_size();
+    DSTRUCT_ASSERT(freeMemSize == 1024);
+
+// allocate/release memory - test
+    dstruct::Array<void *, 8> memArr;
+    int memAllocSeq[8] {8, 32, 64, 200, 16, 256, 128, 8};
+
+    for (int i = 0; i < static_cast<int>(memArr.size()); i++) {
+        memArr[i] = MyMemAlloc::allocate(memAllocSeq[i]);
+        DSTRUCT_ASSERT(memArr[i] != nullptr);
+        if (i > 0) { // split from the same free block, keep address order
+            DSTRUCT_ASSERT(memArr[i - 1] < memArr[i]);
+        }
+    }
+
+    MyMemAlloc::dump();
+
+    // double free / size mismatch check
+    DSTRUCT_ASSERT(MyMemAlloc::deallocate(memArr[3], 1024) == false);
+
+// coalesce - test: release memory in random order, no memory_merge
+    int releaseSeq[8] { 1, 3, 5, 7, 0, 6, 2, 4 };
+    for (int i = 0; i < static_cast<int>(memArr.size()); i++) {
+        int index = releaseSeq[i];
+        DSTRUCT_ASSERT(MyMemAlloc::deallocate(memArr[index], memAllocSeq[index]) == true);
+        MyMemAlloc::dump();
+    }
+
+    DSTRUCT_ASSERT(MyMemAlloc::deallocate(memArr[0], memAllocSeq[0]) == false);
+    DSTRUCT_ASSERT(MyMemAlloc::free_mem_size() == freeMemSize);
+
+    // all blocks merged to one
+    void *mem = MyMemAlloc::allocate(MyMemAlloc::max_free_mblock_size());
+    DSTRUCT_ASSERT(mem != nullptr);
+    DSTRUCT_ASSERT(MyMemAlloc::free_mem_size() == 0);
+    DSTRUCT_ASSERT(MyMemAlloc::allocate(8) == nullptr);
+    DSTRUCT_ASSERT(MyMemAlloc::deallocate(mem, 1) == true);
+    MyMemAlloc::dump();
+
+// steady churn - test
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < static_cast<int>(memArr.size()); i++) {
+            memArr[i] = MyMemAlloc::allocate(memAllocSeq[(i + round) % 8]);
+            DSTRUCT_ASSERT(memArr[i] != nullptr);
+        }
+        for (int i = memArr.size() - 1; i >= 0; i -= 2) {
+            MyMemAlloc::deallocate(memArr[i], memAllocSeq[(i + round) % 8]);
+        }
+        for (int i = memArr.size() - 2; i >= 0; i -= 2) {
+            MyMemAlloc::deallocate(memArr[i], memAllocSeq[(i + round) % 8]);
+        }
+    }
+
+    MyMemAlloc::dump();
+    DSTRUCT_ASSERT(MyMemAlloc::free_mem_size() == freeMemSize);
+}
+
 }
 
 #endif
\ No newline at end of file
@@ -9,6 +9,8 @@ int main() {
     test::test_destroy<dstruct::Vector<test::Destory>>();
 
     test::test_sma_allocator();
+    test::test_sma_allocator_size_class();
+    test::test_boundary_tag_sma_allocator();
 
     std::cout << "   pass" << std::endl;
 }
\ No newline at end of file
@@ -28,6 +28,10 @@ target("dstruct_vector")
     set_kind("binary")
     add_files("examples/array/vector.cpp")
 
+target("dstruct_small_vector")
+    set_kind("binary")
+    add_files("examples/array/small_vector.cpp")
+
 target("dstruct_string")
     set_kind("binary")
     add_files("examples/string.cpp")
@@ -48,6 +52,27 @@ target("dstruct_queue")
     set_kind("binary")
     add_files("examples/queue/queue.cpp")
 
+target("dstruct_spsc_queue")
+    set_kind("binary")
+    add_files("examples/queue/spsc_queue.cpp")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+target("dstruct_mpmc_queue")
+    set_kind("binary")
+    add_files("examples/queue/mpmc_queue.cpp")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+target("dstruct_work_stealing_deque")
+    set_kind("binary")
+    add_files("examples/queue/work_stealing_deque.cpp")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
 target("dstruct_deque")
     set_kind("binary")
     add_files("examples/queue/deque.cpp")
@@ -64,6 +89,18 @@ target("dstruct_heap")
     set_kind("binary")
     add_files("examples/heap.cpp")
 
+target("dstruct_indexed_heap")
+    set_kind("binary")
+    add_files("examples/indexed_heap.cpp")
+
+target("dstruct_pairing_heap")
+    set_kind("binary")
+    add_files("examples/pairing_heap.cpp")
+
+target("dstruct_radix_heap")
+    set_kind("binary")
+    add_files("examples/radix_heap.cpp")
+
 target("dstruct_binary_search_tree")
     set_kind("binary")
     add_files("examples/tree/binary_search_tree.cpp")
@@ -72,6 +109,10 @@ target("dstruct_avl_tree")
     set_kind("binary")
     add_files("examples/tree/avl_tree.cpp")
 
+target("dstruct_rb_tree")
+    set_kind("binary")
+    add_files("examples/tree/rb_tree.cpp")
+
 target("dstruct_ufset")
     set_kind("binary")
     add_files("examples/set/ufset.cpp")
@@ -80,6 +121,14 @@ target("dstruct_map")
     set_kind("binary")
     add_files("examples/map.cpp")
 
+target("dstruct_hash_map")
+    set_kind("binary")
+    add_files("examples/hash_map.cpp")
+
+target("dstruct_btree_map")
+    set_kind("binary")
+    add_files("examples/btree_map.cpp")
+
 target("dstruct_smemory_vector")
     set_kind("binary")
     add_files("examples/smemory_vector.cpp")
@@ -93,7 +142,170 @@ target("dstruct_heap_algo")
     set_kind("binary")
     add_files("examples/algorithms/heap_algo.cpp")
 
+target("dstruct_sort")
+    set_kind("binary")
+    add_files("examples/algorithms/sort.cpp")
+
+target("dstruct_parallel_for_each")
+    set_kind("binary")
+    add_files("examples/algorithms/parallel_for_each.cpp")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
 -- other
 target("dstruct_static_mem_allocator")
     set_kind("binary")
-    add_files("examples/static_mem_allocator.cpp")
\ No newline at end of file
+    add_files("examples/static_mem_allocator.cpp")
+
+target("dstruct_monotonic_arena")
+    set_kind("binary")
+    add_files("examples/monotonic_arena.cpp")
+
+target("dstruct_monotonic_allocator")
+    set_kind("binary")
+    add_files("examples/monotonic_allocator.cpp")
+
+target("dstruct_pool_alloc")
+    set_kind("binary")
+    add_files("examples/pool_alloc.cpp")
+
+target("dstruct_concurrent_mem_allocator")
+    set_kind("binary")
+    add_files("examples/concurrent_mem_allocator.cpp")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+-- benchmark: xmake f -m release && xmake build -g benchmark && xmake r -g benchmark
+target("dstruct_bench_sma_alloc_latency")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/sma_alloc_latency.cpp")
+
+target("dstruct_bench_concurrent_sma_throughput")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/concurrent_sma_throughput.cpp")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+target("dstruct_bench_monotonic_alloc_build")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/monotonic_alloc_build.cpp")
+
+target("dstruct_bench_pool_alloc_node")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/pool_alloc_node.cpp")
+
+target("dstruct_bench_vector_growth")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/vector_growth.cpp")
+
+target("dstruct_bench_vector_policy")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/vector_policy.cpp")
+
+target("dstruct_bench_small_vector")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/small_vector.cpp")
+
+target("dstruct_bench_vector_bulk")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/vector_bulk.cpp")
+
+target("dstruct_bench_deque_random_access")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/deque_random_access.cpp")
+
+target("dstruct_bench_deque_fifo")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/deque_fifo.cpp")
+
+target("dstruct_bench_spsc_queue")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/spsc_queue.cpp")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+target("dstruct_bench_mpmc_queue")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/mpmc_queue.cpp")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+target("dstruct_bench_work_stealing")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/work_stealing.cpp")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+target("dstruct_bench_heap")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/heap.cpp")
+
+target("dstruct_bench_dijkstra")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/dijkstra.cpp")
+
+target("dstruct_bench_pairing_radix_heap")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/pairing_radix_heap.cpp")
+
+target("dstruct_bench_sort")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/sort.cpp")
+
+target("dstruct_bench_hash_map")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/hash_map.cpp")
+
+target("dstruct_bench_btree_map")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/btree_map.cpp")
+
+target("dstruct_bench_rb_tree")
+    set_kind("binary")
+    set_default(false)
+    set_group("benchmark")
+    add_files("benchmarks/rb_tree.cpp")